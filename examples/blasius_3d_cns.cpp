@@ -50,9 +50,7 @@ SubrosaDG::BoundaryCondition<SimulationControl>::calculatePrimitiveFromCoordinat
 }
 
 int main(int argc, char* argv[]) {
-  static_cast<void>(argc);
-  static_cast<void>(argv);
-  SubrosaDG::System<SimulationControl> system;
+  SubrosaDG::System<SimulationControl> system(argc, argv);
   system.setMesh(kExampleDirectory / "blasius_3d_cns.msh", generateMesh);
   system.addBoundaryCondition<SubrosaDG::BoundaryConditionEnum::RiemannFarfield>(1);
   system.addBoundaryCondition<SubrosaDG::BoundaryConditionEnum::Periodic>(2);
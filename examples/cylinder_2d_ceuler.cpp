@@ -44,9 +44,7 @@ SubrosaDG::BoundaryCondition<SimulationControl>::calculatePrimitiveFromCoordinat
 }
 
 int main(int argc, char* argv[]) {
-  static_cast<void>(argc);
-  static_cast<void>(argv);
-  SubrosaDG::System<SimulationControl> system;
+  SubrosaDG::System<SimulationControl> system(argc, argv);
   system.setMesh(kExampleDirectory / "cylinder_2d_ceuler.msh", generateMesh);
   system.addBoundaryCondition<SubrosaDG::BoundaryConditionEnum::RiemannFarfield>(1);
   system.addBoundaryCondition<SubrosaDG::BoundaryConditionEnum::AdiabaticSlipWall>(2);
@@ -69,9 +69,7 @@ SubrosaDG::BoundaryCondition<SimulationControl>::calculatePrimitiveFromCoordinat
 }
 
 int main(int argc, char* argv[]) {
-  static_cast<void>(argc);
-  static_cast<void>(argv);
-  SubrosaDG::System<SimulationControl> system;
+  SubrosaDG::System<SimulationControl> system(argc, argv);
   system.setMesh(kExampleDirectory / std::format("{}.msh", kExampleName), generateMesh);
   system.addBoundaryCondition<SubrosaDG::BoundaryConditionEnum::VelocityInflow>(1);
   system.addBoundaryCondition<SubrosaDG::BoundaryConditionEnum::PressureOutflow>(2);
@@ -145,9 +143,7 @@ int main(int argc, char* argv[]) {
 // }
 
 // int main(int argc, char* argv[]) {
-//   static_cast<void>(argc);
-//   static_cast<void>(argv);
-//   SubrosaDG::System<SimulationControl> system;
+//   SubrosaDG::System<SimulationControl> system(argc, argv);
 //   system.setMesh(kExampleDirectory / std::format("{}.msh", kExampleName), generateMesh);
 //   system.addBoundaryCondition<SubrosaDG::BoundaryConditionEnum::VelocityInflow>(1);
 //   system.addBoundaryCondition<SubrosaDG::BoundaryConditionEnum::PressureOutflow>(2);
@@ -0,0 +1,97 @@
+/**
+ * @file periodictransfer_2d_ceuler.cpp
+ * @brief The source file for SubrosaDG example periodictransfer_2d_ceuler.
+ *
+ * @author Yufei.Liu, Calm.Liu@outlook.com | Chenyu.Bao, bcynuaa@163.com
+ * @date 2025-06-10
+ *
+ * @version 0.1.0
+ * @copyright Copyright (c) 2022 - 2025 by SubrosaDG developers. All rights reserved.
+ * SubrosaDG is free software and is distributed under the MIT license.
+ */
+
+#include "SubrosaDG.cpp"
+
+inline const std::string kExampleName{"periodictransfer_2d_ceuler"};
+
+inline const std::filesystem::path kExampleDirectory{SubrosaDG::kProjectSourceDirectory / "build/out" / kExampleName};
+
+// NOTE: The solution of periodic_2d_ceuler at step 1000 is transferred to a refined copy of its mesh, so that example
+// has to be run first with at least 1000 steps and a view interval dividing 1000.
+inline const std::filesystem::path kSourceDirectory{SubrosaDG::kProjectSourceDirectory /
+                                                    "build/out/periodic_2d_ceuler"};
+
+using SimulationControl = SubrosaDG::SimulationControl<
+    SubrosaDG::SolveControl<SubrosaDG::DimensionEnum::D2, SubrosaDG::PolynomialOrderEnum::P3,
+                            SubrosaDG::BoundaryTimeEnum::Steady, SubrosaDG::SourceTermEnum::None>,
+    SubrosaDG::NumericalControl<SubrosaDG::MeshModelEnum::Quadrangle, SubrosaDG::ShockCapturingEnum::None,
+                                SubrosaDG::LimiterEnum::None, SubrosaDG::InitialConditionEnum::MeshTransfer,
+                                SubrosaDG::TimeIntegrationEnum::SSPRK3>,
+    SubrosaDG::CompresibleEulerVariable<SubrosaDG::ThermodynamicModelEnum::Constant,
+                                        SubrosaDG::EquationOfStateEnum::IdealGas, SubrosaDG::ConvectiveFluxEnum::HLLC>>;
+
+template <typename SimulationControl>
+inline Eigen::Vector<SubrosaDG::Real, SimulationControl::kPrimitiveVariableNumber>
+SubrosaDG::InitialCondition<SimulationControl>::calculatePrimitiveFromCoordinate(
+    [[maybe_unused]] const Eigen::Vector<Real, SimulationControl::kDimension>& coordinate) const {
+  return Eigen::Vector<SubrosaDG::Real, SimulationControl::kPrimitiveVariableNumber>::Zero();
+}
+
+template <typename SimulationControl>
+inline Eigen::Vector<SubrosaDG::Real, SimulationControl::kPrimitiveVariableNumber>
+SubrosaDG::BoundaryCondition<SimulationControl>::calculatePrimitiveFromCoordinate(
+    [[maybe_unused]] const Eigen::Vector<SubrosaDG::Real, SimulationControl::kDimension>& coordinate,
+    [[maybe_unused]] const SubrosaDG::Isize gmsh_physical_index) const {
+  return Eigen::Vector<SubrosaDG::Real, SimulationControl::kPrimitiveVariableNumber>::Zero();
+}
+
+int main(int argc, char* argv[]) {
+  SubrosaDG::System<SimulationControl> system(argc, argv);
+  system.setMesh(kExampleDirectory / "periodictransfer_2d_ceuler.msh", generateMesh);
+  system.addInitialCondition<SimulationControl::kInitialCondition>(
+      kSourceDirectory / "periodic_2d_ceuler.msh", kSourceDirectory / "raw/periodic_2d_ceuler_1000.zst");
+  system.addBoundaryCondition<SubrosaDG::BoundaryConditionEnum::Periodic>(1);
+  system.setThermodynamicModel<SimulationControl::kThermodynamicModel>(2.5_r, 25.0_r / 14.0_r);
+  system.setTimeIntegration(1.0_r, {0, 1000});
+  system.setDeltaTime(5.0e-04_r);
+  system.setViewConfig(kExampleDirectory, kExampleName, 100);
+  system.addViewVariable({SubrosaDG::ViewVariableEnum::Density, SubrosaDG::ViewVariableEnum::Velocity,
+                          SubrosaDG::ViewVariableEnum::Pressure});
+  system.synchronize();
+  system.solve();
+  system.view();
+  return EXIT_SUCCESS;
+}
+
+void generateMesh(const std::filesystem::path& mesh_file_path) {
+  gmsh::model::add("periodictransfer_2d");
+  gmsh::model::geo::addPoint(0.0, 0.0, 0.0);
+  gmsh::model::geo::addPoint(2.0, 0.0, 0.0);
+  gmsh::model::geo::addPoint(2.0, 2.0, 0.0);
+  gmsh::model::geo::addPoint(0.0, 2.0, 0.0);
+  gmsh::model::geo::addLine(1, 2);
+  gmsh::model::geo::addLine(2, 3);
+  gmsh::model::geo::addLine(4, 3);
+  gmsh::model::geo::addLine(1, 4);
+  gmsh::model::geo::addCurveLoop({1, 2, -3, -4});
+  gmsh::model::geo::addPlaneSurface({1});
+  gmsh::model::geo::mesh::setTransfiniteCurve(1, 21);
+  gmsh::model::geo::mesh::setTransfiniteCurve(2, 21);
+  gmsh::model::geo::mesh::setTransfiniteCurve(3, 21);
+  gmsh::model::geo::mesh::setTransfiniteCurve(4, 21);
+  gmsh::model::geo::mesh::setTransfiniteSurface(1);
+  gmsh::model::geo::mesh::setRecombine(2, 1);
+  gmsh::model::geo::synchronize();
+  Eigen::Matrix<double, 4, 4, Eigen::RowMajor> transform_x =
+      (Eigen::Transform<double, 3, Eigen::Affine>::Identity() * Eigen::Translation<double, 3>(2, 0, 0)).matrix();
+  Eigen::Matrix<double, 4, 4, Eigen::RowMajor> transform_y =
+      (Eigen::Transform<double, 3, Eigen::Affine>::Identity() * Eigen::Translation<double, 3>(0, 2, 0)).matrix();
+  gmsh::model::mesh::setPeriodic(1, {2}, {4}, {transform_x.data(), transform_x.data() + transform_x.size()});
+  gmsh::model::mesh::setPeriodic(1, {3}, {1}, {transform_y.data(), transform_y.data() + transform_y.size()});
+  gmsh::model::addPhysicalGroup(1, {1, 2, 3, 4}, 1, "bc-1");
+  gmsh::model::addPhysicalGroup(2, {1}, 2, "vc-1");
+  gmsh::model::mesh::generate(SimulationControl::kDimension);
+  gmsh::model::mesh::setOrder(SimulationControl::kPolynomialOrder);
+  gmsh::model::mesh::optimize("HighOrder");
+  gmsh::write(mesh_file_path);
+}
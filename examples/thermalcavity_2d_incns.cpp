@@ -52,9 +52,7 @@ SubrosaDG::BoundaryCondition<SimulationControl>::calculatePrimitiveFromCoordinat
 }
 
 int main(int argc, char* argv[]) {
-  static_cast<void>(argc);
-  static_cast<void>(argv);
-  SubrosaDG::System<SimulationControl> system;
+  SubrosaDG::System<SimulationControl> system(argc, argv);
   system.setMesh(kExampleDirectory / "thermalcavity_2d_incns.msh", generateMesh);
   // system.addInitialCondition<SimulationControl::kInitialCondition>(kExampleDirectory / "thermalcavity_2d_incns_4000000.zst");
   system.setSourceTerm<SimulationControl::kSourceTerm>(1.0_r, 0.5_r);
@@ -55,9 +55,7 @@ SubrosaDG::BoundaryCondition<SimulationControl>::calculatePrimitiveFromCoordinat
 }
 
 int main(int argc, char* argv[]) {
-  static_cast<void>(argc);
-  static_cast<void>(argv);
-  SubrosaDG::System<SimulationControl> system;
+  SubrosaDG::System<SimulationControl> system(argc, argv);
   system.setMesh(kExampleDirectory / "thermalcavity_3d_incns.msh", generateMesh);
   system.setSourceTerm<SimulationControl::kSourceTerm>(1.0_r, 0.5_r);
   // system.addInitialCondition(kExampleDirectory / "thermalcavity_3d_incns_500000.raw");
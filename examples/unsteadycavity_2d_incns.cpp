@@ -52,9 +52,7 @@ SubrosaDG::BoundaryCondition<SimulationControl>::calculatePrimitiveFromCoordinat
 }
 
 int main(int argc, char* argv[]) {
-  static_cast<void>(argc);
-  static_cast<void>(argv);
-  SubrosaDG::System<SimulationControl> system;
+  SubrosaDG::System<SimulationControl> system(argc, argv);
   system.setMesh(kExampleDirectory / "unsteadycavity_2d_incns.msh", generateMesh);
   system.setSourceTerm<SimulationControl::kSourceTerm>(1.0_r, 0.0_r);
   system.addInitialCondition(kExampleDirectory / "unsteadycavity_2d_incns_8000000.raw");
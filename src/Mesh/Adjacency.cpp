@@ -31,6 +31,7 @@
 #include "Utils/BasicDataType.cpp"
 #include "Utils/Concept.cpp"
 #include "Utils/Enum.cpp"
+#include "Utils/ParallelControl.cpp"
 
 namespace SubrosaDG {
 
@@ -486,6 +487,7 @@ inline void AdjacencyElementMesh<AdjacencyElementTrait>::getAdjacencyElementMesh
   this->interior_number_ = static_cast<Isize>(interior_tag.size());
   this->boundary_number_ = static_cast<Isize>(boundary_tag.size());
   this->element_.resize(this->interior_number_ + this->boundary_number_);
+  parallelFirstTouch(this->element_);
   this->getAdjacencyElementInteriorMesh(node_coordinate, information, interior_tag,
                                         adjacency_element_mesh_supplemental_map);
   this->getAdjacencyElementBoundaryMesh(node_coordinate, information, boundary_tag,
@@ -25,6 +25,7 @@
 
 #include "Mesh/ReadControl.cpp"
 #include "Utils/BasicDataType.cpp"
+#include "Utils/ParallelControl.cpp"
 
 namespace SubrosaDG {
 
@@ -41,6 +42,7 @@ inline void ElementMesh<ElementTrait>::getElementMesh(
         std::format("{} element number is zero.", magic_enum::enum_name(ElementTrait::kElementType)));
   }
   this->element_.resize(this->number_);
+  parallelFirstTouch(this->element_);
   for (Isize i = 0; i < this->number_; i++) {
     this->element_(i).gmsh_tag_ = static_cast<Isize>(element_tags[static_cast<Usize>(i)]);
     this->element_(i).gmsh_physical_index_ =
@@ -23,6 +23,7 @@
 #include "Utils/BasicDataType.cpp"
 #include "Utils/Concept.cpp"
 #include "Utils/Enum.cpp"
+#include "Utils/ParallelControl.cpp"
 
 namespace SubrosaDG {
 
@@ -32,22 +33,20 @@ inline void AdjacencyElementSolver<AdjacencyElementTrait, SimulationControl>::up
     const PhysicalModel<SimulationControl>& physical_model,
     const BoundaryCondition<SimulationControl>& boundary_condition,
     const TimeIntegration<SimulationControl>& time_integration) {
-  tbb::parallel_for(
-      tbb::blocked_range<Isize>(0, adjacency_element_mesh.boundary_number_),
-      [&](const tbb::blocked_range<Isize>& range) {
-        for (Isize i = range.begin(); i != range.end(); i++) {
-          const Isize gmsh_physical_index =
-              adjacency_element_mesh.element_(i + adjacency_element_mesh.interior_number_).gmsh_physical_index_;
-          for (Isize j = 0; j < AdjacencyElementTrait::kQuadratureNumber; j++) {
-            this->boundary_dummy_variable_(i).primitive_.col(j) = boundary_condition.calculatePrimitiveFromCoordinate(
-                adjacency_element_mesh.element_(i + adjacency_element_mesh.interior_number_)
-                    .quadrature_node_coordinate_.col(j),
-                time_integration.iteration_ * time_integration.delta_time_, gmsh_physical_index);
-          }
-          this->boundary_dummy_variable_(i).calculateConservedFromPrimitive(physical_model);
-          this->boundary_dummy_variable_(i).calculateComputationalFromPrimitive(physical_model);
-        }
-      });
+  parallelFor(0, adjacency_element_mesh.boundary_number_, [&](const tbb::blocked_range<Isize>& range) {
+    for (Isize i = range.begin(); i != range.end(); i++) {
+      const Isize gmsh_physical_index =
+          adjacency_element_mesh.element_(i + adjacency_element_mesh.interior_number_).gmsh_physical_index_;
+      for (Isize j = 0; j < AdjacencyElementTrait::kQuadratureNumber; j++) {
+        this->boundary_dummy_variable_(i).primitive_.col(j) = boundary_condition.calculatePrimitiveFromCoordinate(
+            adjacency_element_mesh.element_(i + adjacency_element_mesh.interior_number_)
+                .quadrature_node_coordinate_.col(j),
+            time_integration.iteration_ * time_integration.delta_time_, gmsh_physical_index);
+      }
+      this->boundary_dummy_variable_(i).calculateConservedFromPrimitive(physical_model);
+      this->boundary_dummy_variable_(i).calculateComputationalFromPrimitive(physical_model);
+    }
+  });
 }
 
 template <typename SimulationControl>
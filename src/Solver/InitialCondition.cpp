@@ -14,8 +14,13 @@
 #define SUBROSA_DG_INITIAL_CONDITION_CPP_
 
 #include <Eigen/Core>
+#include <array>
+#include <cstddef>
 #include <filesystem>
-#include <sstream>
+#include <format>
+#include <magic_enum/magic_enum.hpp>
+#include <stdexcept>
+#include <vector>
 
 #include "Mesh/ReadControl.cpp"
 #include "Solver/BoundaryCondition.cpp"
@@ -27,69 +32,191 @@
 #include "Utils/Concept.cpp"
 #include "Utils/Constant.cpp"
 #include "Utils/Enum.cpp"
+#include "Utils/ParallelControl.cpp"
+#include "View/Probe.cpp"
+#include "View/RawBinaryCompress.cpp"
 
 namespace SubrosaDG {
 
 template <typename SimulationControl>
 struct InitialCondition {
   std::filesystem::path raw_binary_path_;
-  std::stringstream raw_binary_ss_;
+  RawBinaryHeader raw_binary_header_;
+  std::vector<RawBinaryBlock> raw_binary_block_;
+  std::vector<char> raw_binary_;
+  std::size_t raw_binary_offset_{0};
+  std::filesystem::path source_mesh_path_;
+  Mesh<SimulationControl> source_mesh_;
+  ProbeBoundingVolumeHierarchy<SimulationControl::kDimension> source_bounding_volume_hierarchy_;
+  ProbeBasisFunction<SimulationControl> source_probe_basis_function_;
+  std::array<std::size_t, magic_enum::enum_count<ElementEnum>()> source_element_offset_{};
 
   inline Eigen::Vector<Real, SimulationControl::kPrimitiveVariableNumber> calculatePrimitiveFromCoordinate(
       const Eigen::Vector<Real, SimulationControl::kDimension>& coordinate) const;
 
+  // NOTE: The source mesh is read after the target mesh and replaces it in gmsh, both meshes need the same physical
+  // groups since the periodic boundaries of the source mesh are taken from the target mesh. The point search inverts
+  // the full Lagrange map of each source element with bases tabulated here, so gmsh is not called in the parallel
+  // search.
+  inline void initializeSourceMesh(const MeshInformation& information) {
+    this->source_mesh_.initializeMesh(this->source_mesh_path_);
+    if (this->source_mesh_.information_.physical_number_ != information.physical_number_) [[unlikely]] {
+      throw std::runtime_error(std::format("Source mesh {} has {} physical groups but the mesh has {}.",
+                                           this->source_mesh_path_.string(),
+                                           this->source_mesh_.information_.physical_number_,
+                                           information.physical_number_));
+    }
+    for (Isize i = 0; i < information.physical_number_; i++) {
+      this->source_mesh_.information_.physical_[static_cast<Usize>(i)].boundary_condition_type_ =
+          information.physical_[static_cast<Usize>(i)].boundary_condition_type_;
+    }
+    this->source_mesh_.readMeshElement();
+    this->source_bounding_volume_hierarchy_.build(this->source_mesh_);
+    this->source_probe_basis_function_.initializeProbeBasisFunction();
+  }
+
   template <typename ElementTrait>
-  void getVariableBasisFunctionCoefficient(
-      const ElementMesh<ElementTrait>& element_mesh,
-      Eigen::Array<Eigen::Matrix<Real, SimulationControl::kConservedVariableNumber, ElementTrait::kBasisFunctionNumber>,
-                   Eigen::Dynamic, 1>& variable_basis_function_coefficient) {
-    if constexpr (SimulationControl::kInitialCondition == InitialConditionEnum::LastStep) {
-      for (Isize i = 0; i < element_mesh.number_; i++) {
-        this->raw_binary_ss_.read(
-            reinterpret_cast<char*>(variable_basis_function_coefficient(i).data()),
-            SimulationControl::kConservedVariableNumber * ElementTrait::kBasisFunctionNumber * kRealSize);
-        if constexpr (IsNS<SimulationControl::kEquationModel>) {
-          Eigen::Matrix<Real, SimulationControl::kConservedVariableNumber * SimulationControl::kDimension,
-                        ElementTrait::kBasisFunctionNumber>
-              variable_gradient_basis_function_coefficient;
-          this->raw_binary_ss_.read(reinterpret_cast<char*>(variable_gradient_basis_function_coefficient.data()),
-                                    SimulationControl::kConservedVariableNumber * SimulationControl::kDimension *
-                                        ElementTrait::kBasisFunctionNumber * kRealSize);
-        }
+  inline void initializeSourceElementOffset() {
+    for (const RawBinaryBlock& block : this->raw_binary_block_) {
+      if (block.type_ == magic_enum::enum_integer(RawBinaryBlockEnum::Element) &&
+          block.gmsh_type_number_ == ElementTrait::kGmshTypeNumber) {
+        this->source_element_offset_[static_cast<Usize>(magic_enum::enum_integer(ElementTrait::kElementType))] =
+            block.offset_;
+        return;
+      }
+    }
+  }
+
+  // NOTE: The offset of the element block of each type in the source raw binary is looked up once after it is read.
+  inline void initializeSourceRawBinary() {
+    if constexpr (SimulationControl::kDimension == 1) {
+      this->initializeSourceElementOffset<LineTrait<SimulationControl::kPolynomialOrder>>();
+    } else if constexpr (SimulationControl::kDimension == 2) {
+      this->initializeSourceElementOffset<TriangleTrait<SimulationControl::kPolynomialOrder>>();
+      this->initializeSourceElementOffset<QuadrangleTrait<SimulationControl::kPolynomialOrder>>();
+    } else if constexpr (SimulationControl::kDimension == 3) {
+      this->initializeSourceElementOffset<TetrahedronTrait<SimulationControl::kPolynomialOrder>>();
+      this->initializeSourceElementOffset<PyramidTrait<SimulationControl::kPolynomialOrder>>();
+      this->initializeSourceElementOffset<HexahedronTrait<SimulationControl::kPolynomialOrder>>();
+    }
+  }
+
+  template <typename ElementTrait>
+  inline Eigen::Vector<Real, SimulationControl::kConservedVariableNumber> getSourceElementConserved(
+      const Isize element_index, const Eigen::Vector<Real, Eigen::Dynamic>& modal_value) const {
+    const bool is_compact = this->raw_binary_header_.type_ == magic_enum::enum_integer(RawBinaryTypeEnum::Compact);
+    const Eigen::Map<const Eigen::Matrix<Real, SimulationControl::kConservedVariableNumber,
+                                         ElementTrait::kBasisFunctionNumber>>
+        source_variable_basis_function_coefficient(reinterpret_cast<const Real*>(
+            this->raw_binary_.data() +
+            this->source_element_offset_[static_cast<Usize>(magic_enum::enum_integer(ElementTrait::kElementType))] +
+            static_cast<std::size_t>(element_index) *
+                getElementRawBinarySize<ElementTrait, SimulationControl>(is_compact)));
+    return source_variable_basis_function_coefficient * modal_value;
+  }
+
+  // NOTE: A point outside every source element is extrapolated from the nearest one. The modal value is a scratch
+  // vector of the caller.
+  inline Eigen::Vector<Real, SimulationControl::kConservedVariableNumber> calculateConservedFromSourceMesh(
+      const Eigen::Vector<Real, SimulationControl::kDimension>& coordinate,
+      Eigen::Vector<Real, Eigen::Dynamic>& modal_value) const {
+    const ProbeBoundingBox<SimulationControl::kDimension>* source_bounding_box = nullptr;
+    if (!this->source_bounding_volume_hierarchy_.find(
+            coordinate, [&](const ProbeBoundingBox<SimulationControl::kDimension>& bounding_box) {
+              source_bounding_box = &bounding_box;
+              return locateMeshProbe(this->source_mesh_, this->source_probe_basis_function_, bounding_box, coordinate,
+                                     modal_value);
+            })) {
+      source_bounding_box = &this->source_bounding_volume_hierarchy_.findNearest(coordinate);
+      locateMeshProbe(this->source_mesh_, this->source_probe_basis_function_, *source_bounding_box, coordinate,
+                      modal_value, true);
+    }
+    const Isize element_index = source_bounding_box->element_index_;
+    if constexpr (SimulationControl::kDimension == 1) {
+      return this->getSourceElementConserved<LineTrait<SimulationControl::kPolynomialOrder>>(element_index,
+                                                                                             modal_value);
+    } else if constexpr (SimulationControl::kDimension == 2) {
+      if (source_bounding_box->gmsh_type_ == TriangleTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+        return this->getSourceElementConserved<TriangleTrait<SimulationControl::kPolynomialOrder>>(element_index,
+                                                                                                   modal_value);
       }
+      return this->getSourceElementConserved<QuadrangleTrait<SimulationControl::kPolynomialOrder>>(element_index,
+                                                                                                   modal_value);
+    } else if constexpr (SimulationControl::kDimension == 3) {
+      if (source_bounding_box->gmsh_type_ == TetrahedronTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+        return this->getSourceElementConserved<TetrahedronTrait<SimulationControl::kPolynomialOrder>>(element_index,
+                                                                                                      modal_value);
+      }
+      if (source_bounding_box->gmsh_type_ == PyramidTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+        return this->getSourceElementConserved<PyramidTrait<SimulationControl::kPolynomialOrder>>(element_index,
+                                                                                                  modal_value);
+      }
+      return this->getSourceElementConserved<HexahedronTrait<SimulationControl::kPolynomialOrder>>(element_index,
+                                                                                                   modal_value);
+    }
+  }
+
+  template <typename ElementTrait>
+  void getVariableBasisFunctionCoefficient(const ElementMesh<ElementTrait>& element_mesh,
+                                           ElementSolver<ElementTrait, SimulationControl>& element_solver) {
+    [[maybe_unused]] const bool is_compact =
+        this->raw_binary_header_.type_ == magic_enum::enum_integer(RawBinaryTypeEnum::Compact);
+    if constexpr (SimulationControl::kInitialCondition == InitialConditionEnum::LastStep) {
+      element_solver.readElementRawBinary(is_compact, this->raw_binary_, this->raw_binary_offset_);
     } else if constexpr (SimulationControl::kInitialCondition == InitialConditionEnum::SpecificFile) {
       constexpr int kBasisFunctionNumber{
           getElementBasisFunctionNumber<ElementTrait::kElementType, SimulationControl::kPolynomialOrder - 1>()};
-      Eigen::Matrix<Real, SimulationControl::kConservedVariableNumber, kBasisFunctionNumber>
-          initial_variable_basis_function_coefficient;
-      for (Isize i = 0; i < element_mesh.number_; i++) {
-        this->raw_binary_ss_.read(reinterpret_cast<char*>(initial_variable_basis_function_coefficient.data()),
-                                  SimulationControl::kConservedVariableNumber * kBasisFunctionNumber * kRealSize);
-        if constexpr (IsNS<SimulationControl::kEquationModel>) {
-          Eigen::Matrix<Real, SimulationControl::kConservedVariableNumber * SimulationControl::kDimension,
-                        kBasisFunctionNumber>
-              variable_gradient_basis_function_coefficient;
-          this->raw_binary_ss_.read(reinterpret_cast<char*>(variable_gradient_basis_function_coefficient.data()),
-                                    SimulationControl::kConservedVariableNumber * SimulationControl::kDimension *
-                                        kBasisFunctionNumber * kRealSize);
+      const std::size_t element_raw_binary_size{
+          static_cast<std::size_t>(SimulationControl::kConservedVariableNumber * kBasisFunctionNumber * kRealSize) *
+          (IsNS<SimulationControl::kEquationModel> && !is_compact ? SimulationControl::kDimension + 1 : 1)};
+      parallelFor(0, element_mesh.number_, [&](const tbb::blocked_range<Isize>& range) {
+        for (Isize i = range.begin(); i != range.end(); i++) {
+          const Eigen::Map<const Eigen::Matrix<Real, SimulationControl::kConservedVariableNumber, kBasisFunctionNumber>>
+              initial_variable_basis_function_coefficient(reinterpret_cast<const Real*>(
+                  this->raw_binary_.data() + this->raw_binary_offset_ +
+                  static_cast<std::size_t>(i) * element_raw_binary_size));
+          element_solver.element_(i).variable_basis_function_coefficient_.setZero();
+          element_solver.element_(i).variable_basis_function_coefficient_(
+              Eigen::all, Eigen::seqN(Eigen::fix<0>, Eigen::fix<kBasisFunctionNumber>)) =
+              initial_variable_basis_function_coefficient;
         }
-        variable_basis_function_coefficient(i).setZero();
-        variable_basis_function_coefficient(i)(Eigen::all,
-                                               Eigen::seqN(Eigen::fix<0>, Eigen::fix<kBasisFunctionNumber>)) =
-            initial_variable_basis_function_coefficient;
-      }
+      });
+      this->raw_binary_offset_ += static_cast<std::size_t>(element_mesh.number_) * element_raw_binary_size;
+    } else if constexpr (SimulationControl::kInitialCondition == InitialConditionEnum::MeshTransfer) {
+      // NOTE: The source solution is sampled at the quadrature nodes and projected in the least squares sense, the same
+      // way as an initial condition given by a function.
+      parallelFor(0, element_mesh.number_, [&](const tbb::blocked_range<Isize>& range) {
+        Eigen::Vector<Real, Eigen::Dynamic> modal_value;
+        for (Isize i = range.begin(); i != range.end(); i++) {
+          ElementVariable<ElementTrait, SimulationControl> variable;
+          for (Isize j = 0; j < ElementTrait::kQuadratureNumber; j++) {
+            variable.conserved_.col(j) = this->calculateConservedFromSourceMesh(
+                element_mesh.element_(i).quadrature_node_coordinate_.col(j), modal_value);
+          }
+          element_solver.element_(i).variable_basis_function_coefficient_.noalias() =
+              variable.conserved_ * element_mesh.basis_function_.modal_value_ *
+              element_mesh.basis_function_.modal_least_squares_inverse_;
+        }
+      });
     }
   }
 };
 
 template <typename ElementTrait, typename SimulationControl>
 inline void ElementSolver<ElementTrait, SimulationControl>::initializeElementSolver(
-    const ElementMesh<ElementTrait>& element_mesh, const PhysicalModel<SimulationControl>& physical_model,
-    InitialCondition<SimulationControl>& initial_condition) {
+    const ElementMesh<ElementTrait>& element_mesh, const bool quadrature_variable_cache) {
   this->number_ = element_mesh.number_;
   this->element_.resize(this->number_);
+  parallelFirstTouch(this->element_);
+  this->initializeElementQuadratureVariableCache(quadrature_variable_cache);
+}
+
+template <typename ElementTrait, typename SimulationControl>
+inline void ElementSolver<ElementTrait, SimulationControl>::initializeElementVariable(
+    const ElementMesh<ElementTrait>& element_mesh, const PhysicalModel<SimulationControl>& physical_model,
+    InitialCondition<SimulationControl>& initial_condition) {
   if constexpr (SimulationControl::kInitialCondition == InitialConditionEnum::Function) {
-    tbb::parallel_for(tbb::blocked_range<Isize>(0, this->number_), [&](const tbb::blocked_range<Isize>& range) {
+    parallelFor(0, this->number_, [&](const tbb::blocked_range<Isize>& range) {
       for (Isize i = range.begin(); i != range.end(); i++) {
         ElementVariable<ElementTrait, SimulationControl> variable;
         for (Isize j = 0; j < ElementTrait::kQuadratureNumber; j++) {
@@ -103,88 +230,152 @@ inline void ElementSolver<ElementTrait, SimulationControl>::initializeElementSol
       }
     });
   } else {
-    Eigen::Array<Eigen::Matrix<Real, SimulationControl::kConservedVariableNumber, ElementTrait::kBasisFunctionNumber>,
-                 Eigen::Dynamic, 1>
-        variable_basis_function_coefficient(this->number_);
-    initial_condition.getVariableBasisFunctionCoefficient(element_mesh, variable_basis_function_coefficient);
-    tbb::parallel_for(tbb::blocked_range<Isize>(0, this->number_), [&](const tbb::blocked_range<Isize>& range) {
-      for (Isize i = range.begin(); i != range.end(); i++) {
-        this->element_(i).variable_basis_function_coefficient_.noalias() = variable_basis_function_coefficient(i);
-      }
-    });
+    initial_condition.getVariableBasisFunctionCoefficient(element_mesh, *this);
   }
 }
 
+template <typename ElementTrait, typename SimulationControl>
+inline void ElementSolver<ElementTrait, SimulationControl>::initializeElementQuadratureVariableCache(
+    const bool quadrature_variable_cache) {
+  this->quadrature_node_variable_cache_.resize(quadrature_variable_cache ? this->number_ : 0);
+  parallelFirstTouch(this->quadrature_node_variable_cache_);
+}
+
+template <typename AdjacencyElementTrait, typename SimulationControl>
+inline void
+AdjacencyElementSolver<AdjacencyElementTrait, SimulationControl>::initializeAdjacencyElementQuadratureVariableCache(
+    const bool quadrature_variable_cache) {
+  this->left_quadrature_node_variable_cache_.resize(
+      quadrature_variable_cache ? this->interior_number_ + this->boundary_number_ : 0);
+  this->right_quadrature_node_variable_cache_.resize(quadrature_variable_cache ? this->interior_number_ : 0);
+  parallelFirstTouch(this->left_quadrature_node_variable_cache_);
+  parallelFirstTouch(this->right_quadrature_node_variable_cache_);
+}
+
 template <typename AdjacencyElementTrait, typename SimulationControl>
 inline void AdjacencyElementSolver<AdjacencyElementTrait, SimulationControl>::initializeAdjacencyElementSolver(
     const AdjacencyElementMesh<AdjacencyElementTrait>& adjacency_element_mesh,
     const PhysicalModel<SimulationControl>& physical_model,
-    const BoundaryCondition<SimulationControl>& boundary_condition) {
+    const BoundaryCondition<SimulationControl>& boundary_condition, const bool quadrature_variable_cache) {
   this->interior_number_ = adjacency_element_mesh.interior_number_;
   this->boundary_number_ = adjacency_element_mesh.boundary_number_;
   this->boundary_dummy_variable_.resize(this->boundary_number_);
-  tbb::parallel_for(
-      tbb::blocked_range<Isize>(0, adjacency_element_mesh.boundary_number_),
-      [&](const tbb::blocked_range<Isize>& range) {
-        for (Isize i = range.begin(); i != range.end(); i++) {
-          const Isize gmsh_physical_index =
-              adjacency_element_mesh.element_(i + adjacency_element_mesh.interior_number_).gmsh_physical_index_;
-          for (Isize j = 0; j < AdjacencyElementTrait::kQuadratureNumber; j++) {
-            if constexpr (SimulationControl::kBoundaryTime == BoundaryTimeEnum::Steady) {
-              this->boundary_dummy_variable_(i).primitive_.col(j) = boundary_condition.calculatePrimitiveFromCoordinate(
-                  adjacency_element_mesh.element_(i + adjacency_element_mesh.interior_number_)
-                      .quadrature_node_coordinate_.col(j),
-                  gmsh_physical_index);
-            } else if constexpr (SimulationControl::kBoundaryTime == BoundaryTimeEnum::TimeVarying) {
-              this->boundary_dummy_variable_(i).primitive_.col(j) = boundary_condition.calculatePrimitiveFromCoordinate(
-                  adjacency_element_mesh.element_(i + adjacency_element_mesh.interior_number_)
-                      .quadrature_node_coordinate_.col(j),
-                  0.0_r, gmsh_physical_index);
-            }
-          }
-          this->boundary_dummy_variable_(i).calculateConservedFromPrimitive(physical_model);
-          this->boundary_dummy_variable_(i).calculateComputationalFromPrimitive(physical_model);
+  parallelFirstTouch(this->boundary_dummy_variable_);
+  this->initializeAdjacencyElementQuadratureVariableCache(quadrature_variable_cache);
+  parallelFor(0, adjacency_element_mesh.boundary_number_, [&](const tbb::blocked_range<Isize>& range) {
+    for (Isize i = range.begin(); i != range.end(); i++) {
+      const Isize gmsh_physical_index =
+          adjacency_element_mesh.element_(i + adjacency_element_mesh.interior_number_).gmsh_physical_index_;
+      for (Isize j = 0; j < AdjacencyElementTrait::kQuadratureNumber; j++) {
+        if constexpr (SimulationControl::kBoundaryTime == BoundaryTimeEnum::Steady) {
+          this->boundary_dummy_variable_(i).primitive_.col(j) = boundary_condition.calculatePrimitiveFromCoordinate(
+              adjacency_element_mesh.element_(i + adjacency_element_mesh.interior_number_)
+                  .quadrature_node_coordinate_.col(j),
+              gmsh_physical_index);
+        } else if constexpr (SimulationControl::kBoundaryTime == BoundaryTimeEnum::TimeVarying) {
+          this->boundary_dummy_variable_(i).primitive_.col(j) = boundary_condition.calculatePrimitiveFromCoordinate(
+              adjacency_element_mesh.element_(i + adjacency_element_mesh.interior_number_)
+                  .quadrature_node_coordinate_.col(j),
+              0.0_r, gmsh_physical_index);
         }
-      });
+      }
+      this->boundary_dummy_variable_(i).calculateConservedFromPrimitive(physical_model);
+      this->boundary_dummy_variable_(i).calculateComputationalFromPrimitive(physical_model);
+    }
+  });
 }
 
+// NOTE: Only the arrays are sized and the boundary states are set here, e.g. for a solver that rebuilds compact
+// snapshots and never needs the initial condition.
 template <typename SimulationControl>
-inline void Solver<SimulationControl>::initializeSolver(const Mesh<SimulationControl>& mesh,
-                                                        const PhysicalModel<SimulationControl>& physical_model,
-                                                        const BoundaryCondition<SimulationControl>& boundary_condition,
-                                                        InitialCondition<SimulationControl>& initial_condition) {
+inline void Solver<SimulationControl>::initializeSolver(
+    const Mesh<SimulationControl>& mesh, const PhysicalModel<SimulationControl>& physical_model,
+    const BoundaryCondition<SimulationControl>& boundary_condition) {
   this->node_artificial_viscosity_.resize(mesh.node_number_);
   this->node_artificial_viscosity_.setZero();
   if constexpr (SimulationControl::kDimension == 1) {
-    this->line_.initializeElementSolver(mesh.line_, physical_model, initial_condition);
-    this->point_.initializeAdjacencyElementSolver(mesh.point_, physical_model, boundary_condition);
+    this->line_.initializeElementSolver(mesh.line_, this->quadrature_variable_cache_);
+    this->point_.initializeAdjacencyElementSolver(mesh.point_, physical_model, boundary_condition,
+                                                  this->quadrature_variable_cache_);
   } else if constexpr (SimulationControl::kDimension == 2) {
     if constexpr (HasTriangle<SimulationControl::kMeshModel>) {
-      this->triangle_.initializeElementSolver(mesh.triangle_, physical_model, initial_condition);
+      this->triangle_.initializeElementSolver(mesh.triangle_, this->quadrature_variable_cache_);
     }
     if constexpr (HasQuadrangle<SimulationControl::kMeshModel>) {
-      this->quadrangle_.initializeElementSolver(mesh.quadrangle_, physical_model, initial_condition);
+      this->quadrangle_.initializeElementSolver(mesh.quadrangle_, this->quadrature_variable_cache_);
     }
-    this->line_.initializeAdjacencyElementSolver(mesh.line_, physical_model, boundary_condition);
+    this->line_.initializeAdjacencyElementSolver(mesh.line_, physical_model, boundary_condition,
+                                                 this->quadrature_variable_cache_);
   } else if constexpr (SimulationControl::kDimension == 3) {
     if constexpr (HasTetrahedron<SimulationControl::kMeshModel>) {
-      this->tetrahedron_.initializeElementSolver(mesh.tetrahedron_, physical_model, initial_condition);
+      this->tetrahedron_.initializeElementSolver(mesh.tetrahedron_, this->quadrature_variable_cache_);
     }
     if constexpr (HasPyramid<SimulationControl::kMeshModel>) {
-      this->pyramid_.initializeElementSolver(mesh.pyramid_, physical_model, initial_condition);
+      this->pyramid_.initializeElementSolver(mesh.pyramid_, this->quadrature_variable_cache_);
     }
     if constexpr (HasHexahedron<SimulationControl::kMeshModel>) {
-      this->hexahedron_.initializeElementSolver(mesh.hexahedron_, physical_model, initial_condition);
+      this->hexahedron_.initializeElementSolver(mesh.hexahedron_, this->quadrature_variable_cache_);
     }
     if constexpr (HasAdjacencyTriangle<SimulationControl::kMeshModel>) {
-      this->triangle_.initializeAdjacencyElementSolver(mesh.triangle_, physical_model, boundary_condition);
+      this->triangle_.initializeAdjacencyElementSolver(mesh.triangle_, physical_model, boundary_condition,
+                                                       this->quadrature_variable_cache_);
     }
     if constexpr (HasAdjacencyQuadrangle<SimulationControl::kMeshModel>) {
-      this->quadrangle_.initializeAdjacencyElementSolver(mesh.quadrangle_, physical_model, boundary_condition);
+      this->quadrangle_.initializeAdjacencyElementSolver(mesh.quadrangle_, physical_model, boundary_condition,
+                                                         this->quadrature_variable_cache_);
     }
   }
 }
 
+template <typename SimulationControl>
+inline void Solver<SimulationControl>::initializeSolver(const Mesh<SimulationControl>& mesh,
+                                                        const PhysicalModel<SimulationControl>& physical_model,
+                                                        const BoundaryCondition<SimulationControl>& boundary_condition,
+                                                        InitialCondition<SimulationControl>& initial_condition) {
+  this->initializeSolver(mesh, physical_model, boundary_condition);
+  if constexpr (SimulationControl::kDimension == 1) {
+    this->line_.initializeElementVariable(mesh.line_, physical_model, initial_condition);
+  } else if constexpr (SimulationControl::kDimension == 2) {
+    if constexpr (HasTriangle<SimulationControl::kMeshModel>) {
+      this->triangle_.initializeElementVariable(mesh.triangle_, physical_model, initial_condition);
+    }
+    if constexpr (HasQuadrangle<SimulationControl::kMeshModel>) {
+      this->quadrangle_.initializeElementVariable(mesh.quadrangle_, physical_model, initial_condition);
+    }
+  } else if constexpr (SimulationControl::kDimension == 3) {
+    if constexpr (HasTetrahedron<SimulationControl::kMeshModel>) {
+      this->tetrahedron_.initializeElementVariable(mesh.tetrahedron_, physical_model, initial_condition);
+    }
+    if constexpr (HasPyramid<SimulationControl::kMeshModel>) {
+      this->pyramid_.initializeElementVariable(mesh.pyramid_, physical_model, initial_condition);
+    }
+    if constexpr (HasHexahedron<SimulationControl::kMeshModel>) {
+      this->hexahedron_.initializeElementVariable(mesh.hexahedron_, physical_model, initial_condition);
+    }
+  }
+}
+
+// NOTE: The caches follow the element numbers of an initialized solver, so the switch may also be flipped after the
+// solver is initialized. Before that the numbers are zero and the caches are sized by initializeSolver.
+template <typename SimulationControl>
+inline void Solver<SimulationControl>::setQuadratureVariableCache(const bool quadrature_variable_cache) {
+  this->quadrature_variable_cache_ = quadrature_variable_cache;
+  if constexpr (SimulationControl::kDimension == 1) {
+    this->line_.initializeElementQuadratureVariableCache(quadrature_variable_cache);
+    this->point_.initializeAdjacencyElementQuadratureVariableCache(quadrature_variable_cache);
+  } else if constexpr (SimulationControl::kDimension == 2) {
+    this->triangle_.initializeElementQuadratureVariableCache(quadrature_variable_cache);
+    this->quadrangle_.initializeElementQuadratureVariableCache(quadrature_variable_cache);
+    this->line_.initializeAdjacencyElementQuadratureVariableCache(quadrature_variable_cache);
+  } else if constexpr (SimulationControl::kDimension == 3) {
+    this->tetrahedron_.initializeElementQuadratureVariableCache(quadrature_variable_cache);
+    this->pyramid_.initializeElementQuadratureVariableCache(quadrature_variable_cache);
+    this->hexahedron_.initializeElementQuadratureVariableCache(quadrature_variable_cache);
+    this->triangle_.initializeAdjacencyElementQuadratureVariableCache(quadrature_variable_cache);
+    this->quadrangle_.initializeAdjacencyElementQuadratureVariableCache(quadrature_variable_cache);
+  }
+}
+
 }  // namespace SubrosaDG
 
 #endif  // SUBROSA_DG_INITIAL_CONDITION_CPP_
@@ -897,6 +897,10 @@ inline consteval Real getPolynomialOrderArtificialViscosityTolerance() {
   return kArtificialViscosityTolerance[PolynomialOrder - 1];
 }
 
+// NOTE: Elements are written as VTK Lagrange cells of their own order (68 curve, 69 triangle, 70 quadrilateral, 71
+// tetrahedron, 72 hexahedron) and the connectivity reorders the gmsh nodes into the VTK layout. A pyramid is written as
+// two Lagrange tetrahedra on its own nodes: VTK_LAGRANGE_PYRAMID (74) only exists since VTK 9.1, covers just the low
+// orders, and many readers still fail to open it.
 template <ElementEnum ElementType>
 inline consteval int getElementVtkElementNumber() {
   if constexpr (ElementType == ElementEnum::Pyramid) {
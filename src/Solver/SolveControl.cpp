@@ -14,19 +14,25 @@
 #define SUBROSA_DG_SOLVE_CONTROL_CPP_
 
 #include <Eigen/Core>
+#include <cstddef>
 #include <filesystem>
 #include <fstream>
-#include <future>
-#include <sstream>
+#include <functional>
+#include <memory>
+#include <vector>
 
 #include "Mesh/ReadControl.cpp"
 #include "Solver/PhysicalModel.cpp"
 #include "Solver/SimulationControl.cpp"
 #include "Utils/BasicDataType.cpp"
 #include "Utils/Enum.cpp"
+#include "Utils/ParallelControl.cpp"
+#include "View/RawBinaryCompress.cpp"
 
 namespace SubrosaDG {
 
+template <typename ElementTrait, typename SimulationControl>
+struct ElementVariable;
 template <typename AdjacencyElementTrait, typename SimulationControl>
 struct AdjacencyElementVariable;
 template <typename SimulationControl>
@@ -178,10 +184,15 @@ struct ElementSolver {
   Isize number_{0};
   Eigen::Array<PerElementSolver<ElementTrait, SimulationControl, SimulationControl::kEquationModel>, Eigen::Dynamic, 1>
       element_;
+  Eigen::Array<ElementVariable<ElementTrait, SimulationControl>, Eigen::Dynamic, 1> quadrature_node_variable_cache_;
 
-  inline void initializeElementSolver(const ElementMesh<ElementTrait>& element_mesh,
-                                      const PhysicalModel<SimulationControl>& physical_model,
-                                      InitialCondition<SimulationControl>& initial_condition);
+  inline void initializeElementSolver(const ElementMesh<ElementTrait>& element_mesh, bool quadrature_variable_cache);
+
+  inline void initializeElementVariable(const ElementMesh<ElementTrait>& element_mesh,
+                                        const PhysicalModel<SimulationControl>& physical_model,
+                                        InitialCondition<SimulationControl>& initial_condition);
+
+  inline void initializeElementQuadratureVariableCache(bool quadrature_variable_cache);
 
   inline void copyElementBasisFunctionCoefficient();
 
@@ -196,9 +207,12 @@ struct ElementSolver {
 
   inline void calculateElementQuadrature(const ElementMesh<ElementTrait>& element_mesh,
                                          [[maybe_unused]] const SourceTerm<SimulationControl>& source_term,
-                                         const PhysicalModel<SimulationControl>& physical_model);
+                                         const PhysicalModel<SimulationControl>& physical_model,
+                                         bool quadrature_variable_cache);
 
-  inline void calculateElementGardientQuadrature(const ElementMesh<ElementTrait>& element_mesh);
+  inline void calculateElementGardientQuadrature(const ElementMesh<ElementTrait>& element_mesh,
+                                                 const PhysicalModel<SimulationControl>& physical_model,
+                                                 bool quadrature_variable_cache);
 
   inline void calculateElementDeltaTime(const ElementMesh<ElementTrait>& element_mesh,
                                         const PhysicalModel<SimulationControl>& physical_model,
@@ -217,7 +231,11 @@ struct ElementSolver {
       const ElementMesh<ElementTrait>& element_mesh,
       Eigen::Vector<Real, SimulationControl::kConservedVariableNumber>& relative_error);
 
-  inline void writeElementRawBinary(std::stringstream& raw_binary_ss) const;
+  inline void writeElementRawBinary(bool is_compact, std::vector<char>& raw_binary,
+                                    std::size_t& raw_binary_offset) const;
+
+  inline void readElementRawBinary(bool is_compact, const std::vector<char>& raw_binary,
+                                   std::size_t& raw_binary_offset);
 };
 
 template <typename AdjacencyElementTrait, typename SimulationControl>
@@ -226,11 +244,17 @@ struct AdjacencyElementSolver {
   Isize boundary_number_{0};
   Eigen::Array<AdjacencyElementVariable<AdjacencyElementTrait, SimulationControl>, Eigen::Dynamic, 1>
       boundary_dummy_variable_;
+  Eigen::Array<AdjacencyElementVariable<AdjacencyElementTrait, SimulationControl>, Eigen::Dynamic, 1>
+      left_quadrature_node_variable_cache_;
+  Eigen::Array<AdjacencyElementVariable<AdjacencyElementTrait, SimulationControl>, Eigen::Dynamic, 1>
+      right_quadrature_node_variable_cache_;
 
   inline void initializeAdjacencyElementSolver(
       const AdjacencyElementMesh<AdjacencyElementTrait>& adjacency_element_mesh,
       const PhysicalModel<SimulationControl>& physical_model,
-      const BoundaryCondition<SimulationControl>& boundary_condition);
+      const BoundaryCondition<SimulationControl>& boundary_condition, bool quadrature_variable_cache);
+
+  inline void initializeAdjacencyElementQuadratureVariableCache(bool quadrature_variable_cache);
 
   inline void updateAdjacencyElementBoundaryVariable(
       const AdjacencyElementMesh<AdjacencyElementTrait>& adjacency_element_mesh,
@@ -254,8 +278,9 @@ struct AdjacencyElementSolver {
       const Mesh<SimulationControl>& mesh, const PhysicalModel<SimulationControl>& physical_model,
       const BoundaryCondition<SimulationControl>& boundary_condition, Solver<SimulationControl>& solver);
 
-  inline void calculateInteriorAdjacencyElementGardientQuadrature(const Mesh<SimulationControl>& mesh,
-                                                                  Solver<SimulationControl>& solver);
+  inline void calculateInteriorAdjacencyElementGardientQuadrature(
+      const Mesh<SimulationControl>& mesh, const PhysicalModel<SimulationControl>& physical_model,
+      Solver<SimulationControl>& solver);
 
   inline void calculateBoundaryAdjacencyElementGardientQuadrature(
       const Mesh<SimulationControl>& mesh, const PhysicalModel<SimulationControl>& physical_model,
@@ -280,22 +305,51 @@ struct AdjacencyElementSolver {
 
   template <typename ElementTrait>
   inline void writeBoundaryAdjacencyPerElementRawBinary(
-      const ElementSolver<ElementTrait, SimulationControl>& element_solver, std::stringstream& raw_binary_ss,
+      const ElementSolver<ElementTrait, SimulationControl>& element_solver, char* raw_binary,
       Isize parent_index_each_type, [[maybe_unused]] Isize adjacency_sequence_in_parent) const;
 
   inline void writeBoundaryAdjacencyElementRawBinary(
       const AdjacencyElementMesh<AdjacencyElementTrait>& adjacency_element_mesh,
-      const Solver<SimulationControl>& solver, std::stringstream& raw_binary_ss) const;
+      const Solver<SimulationControl>& solver, std::vector<char>& raw_binary, std::size_t& raw_binary_offset) const;
+};
+
+struct ElementStepTask {
+  std::function<void()> gardient_quadrature_;
+  std::function<void()> quadrature_;
+  std::function<void(int rk_step)> update_;
+};
+
+struct AdjacencyElementStepTask {
+  std::function<void()> interior_gardient_quadrature_;
+  std::function<void()> boundary_gardient_quadrature_;
+  std::function<void()> interior_quadrature_;
+  std::function<void()> boundary_quadrature_;
 };
 
 template <typename SimulationControl>
 struct SolverBase {
   Real empirical_tolerance_{0.0_r};
   Real artificial_viscosity_factor_{1.0_r};
-
-  std::stringstream raw_binary_ss_;
+  bool quadrature_variable_cache_{false};
+  bool step_task_graph_{false};
+  bool raw_binary_compact_{false};
+  bool raw_binary_quantize_{false};
+  Real raw_binary_quantize_tolerance_{0.0_r};
+  int raw_binary_keyframe_interval_{-1};
+  int raw_binary_delta_number_{0};
+  std::vector<ElementStepTask> element_step_task_;
+  std::vector<AdjacencyElementStepTask> adjacency_element_step_task_;
+  std::unique_ptr<TaskGraph> step_task_graph_node_;
+
+  RawBinaryHeader raw_binary_header_;
+  RawBinaryHeader raw_binary_reference_header_;
+  std::vector<RawBinaryBlock> raw_binary_block_;
+  std::vector<RawBinaryBlock> raw_binary_quantized_block_;
+  std::vector<char> raw_binary_;
+  std::vector<char> raw_binary_quantized_;
+  std::vector<char> raw_binary_reference_;
+  RawBinaryWriteQueue raw_binary_write_queue_;
   std::fstream error_finout_;
-  std::future<void> write_raw_binary_future_;
 
   Eigen::Vector<Real, SimulationControl::kConservedVariableNumber> relative_error_{
       Eigen::Vector<Real, SimulationControl::kConservedVariableNumber>::Zero()};
@@ -374,11 +428,17 @@ struct Solver : SolverData<SimulationControl, SimulationControl::kDimension> {
     return nullptr;
   }
 
+  inline void initializeSolver(const Mesh<SimulationControl>& mesh,
+                               const PhysicalModel<SimulationControl>& physical_model,
+                               const BoundaryCondition<SimulationControl>& boundary_condition);
+
   inline void initializeSolver(const Mesh<SimulationControl>& mesh,
                                const PhysicalModel<SimulationControl>& physical_model,
                                const BoundaryCondition<SimulationControl>& boundary_condition,
                                InitialCondition<SimulationControl>& initial_condition);
 
+  inline void setQuadratureVariableCache(bool quadrature_variable_cache);
+
   inline void updateBoundaryVariable(const Mesh<SimulationControl>& mesh,
                                      const PhysicalModel<SimulationControl>& physical_model,
                                      const BoundaryCondition<SimulationControl>& boundary_condition,
@@ -402,7 +462,8 @@ struct Solver : SolverData<SimulationControl, SimulationControl::kDimension> {
                                   [[maybe_unused]] const SourceTerm<SimulationControl>& source_term,
                                   const PhysicalModel<SimulationControl>& physical_model);
 
-  inline void calculateGardientQuadrature(const Mesh<SimulationControl>& mesh);
+  inline void calculateGardientQuadrature(const Mesh<SimulationControl>& mesh,
+                                          const PhysicalModel<SimulationControl>& physical_model);
 
   inline void calculateAdjacencyQuadrature(const Mesh<SimulationControl>& mesh,
                                            const PhysicalModel<SimulationControl>& physical_model,
@@ -430,9 +491,48 @@ struct Solver : SolverData<SimulationControl, SimulationControl::kDimension> {
                          const BoundaryCondition<SimulationControl>& boundary_condition,
                          const TimeIntegration<SimulationControl>& time_integration);
 
+  template <typename ElementTrait>
+  inline void addElementStepTask(const Mesh<SimulationControl>& mesh, const SourceTerm<SimulationControl>& source_term,
+                                 const PhysicalModel<SimulationControl>& physical_model,
+                                 const TimeIntegration<SimulationControl>& time_integration,
+                                 std::vector<ElementStepTask>& element_step_task);
+
+  template <typename AdjacencyElementTrait>
+  inline void addAdjacencyElementStepTask(const Mesh<SimulationControl>& mesh,
+                                          const PhysicalModel<SimulationControl>& physical_model,
+                                          const BoundaryCondition<SimulationControl>& boundary_condition,
+                                          std::vector<AdjacencyElementStepTask>& adjacency_element_step_task);
+
+  inline void initializeStepTaskGraph(const Mesh<SimulationControl>& mesh,
+                                      const SourceTerm<SimulationControl>& source_term,
+                                      const PhysicalModel<SimulationControl>& physical_model,
+                                      const BoundaryCondition<SimulationControl>& boundary_condition,
+                                      const TimeIntegration<SimulationControl>& time_integration);
+
+  inline void stepSolverTaskGraph(const Mesh<SimulationControl>& mesh,
+                                  const SourceTerm<SimulationControl>& source_term,
+                                  const PhysicalModel<SimulationControl>& physical_model,
+                                  const BoundaryCondition<SimulationControl>& boundary_condition,
+                                  const TimeIntegration<SimulationControl>& time_integration);
+
   inline void calculateRelativeError(const Mesh<SimulationControl>& mesh);
 
-  inline void writeRawBinary(const Mesh<SimulationControl>& mesh, const std::filesystem::path& raw_binary_path);
+  inline void packRawBinary(const Mesh<SimulationControl>& mesh, bool is_compact,
+                            std::vector<char>& raw_binary) const;
+
+  inline void unpackRawBinary(bool is_compact, const std::vector<char>& raw_binary);
+
+  inline void writeRawBinary(const Mesh<SimulationControl>& mesh,
+                             const TimeIntegration<SimulationControl>& time_integration,
+                             const std::filesystem::path& raw_binary_path, bool is_checkpoint);
+
+  inline void deltaRawBinary(std::vector<char>& raw_binary);
+
+  inline void rebuildRawBinary(const Mesh<SimulationControl>& mesh,
+                               const PhysicalModel<SimulationControl>& physical_model,
+                               const BoundaryCondition<SimulationControl>& boundary_condition,
+                               const TimeIntegration<SimulationControl>& time_integration,
+                               std::vector<char>& raw_binary);
 };
 
 }  // namespace SubrosaDG
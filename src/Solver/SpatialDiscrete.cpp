@@ -31,6 +31,7 @@
 #include "Utils/Concept.cpp"
 #include "Utils/Constant.cpp"
 #include "Utils/Enum.cpp"
+#include "Utils/ParallelControl.cpp"
 
 namespace SubrosaDG {
 
@@ -42,7 +43,7 @@ inline void ElementSolver<ElementTrait, SimulationControl>::calculateElementArti
       getElementBasisFunctionNumber<ElementTrait::kElementType, SimulationControl::kPolynomialOrder - 1>()};
   constexpr Real kPolynomialOrderArtificialViscosityTolerance{
       getPolynomialOrderArtificialViscosityTolerance<SimulationControl::kPolynomialOrder>()};
-  tbb::parallel_for(tbb::blocked_range<Isize>(0, this->number_), [&](const tbb::blocked_range<Isize>& range) {
+  parallelFor(0, this->number_, [&](const tbb::blocked_range<Isize>& range) {
     for (Isize i = range.begin(); i != range.end(); i++) {
       Eigen::Vector<Real, ElementTrait::kQuadratureNumber> variable_density_high_order;
       const Eigen::Vector<Real, ElementTrait::kQuadratureNumber> variable_density_all_order =
@@ -91,7 +92,7 @@ template <typename ElementTrait, typename SimulationControl>
 inline void ElementSolver<ElementTrait, SimulationControl>::maxElementArtificialViscosity(
     const ElementMesh<ElementTrait>& element_mesh, Eigen::Vector<Real, Eigen::Dynamic>& node_artificial_viscosity) {
   tbb::combinable<Eigen::Vector<Real, Eigen::Dynamic>> node_artificial_viscosity_combinable(node_artificial_viscosity);
-  tbb::parallel_for(tbb::blocked_range<Isize>(0, this->number_), [&](const tbb::blocked_range<Isize>& range) {
+  parallelFor(0, this->number_, [&](const tbb::blocked_range<Isize>& range) {
     for (Isize i = range.begin(); i != range.end(); i++) {
       for (Isize j = 0; j < ElementTrait::kBasicNodeNumber; j++) {
         node_artificial_viscosity_combinable.local()(element_mesh.element_(i).node_tag_(j) - 1) =
@@ -110,7 +111,7 @@ template <typename ElementTrait, typename SimulationControl>
 inline void ElementSolver<ElementTrait, SimulationControl>::storeElementArtificialViscosity(
     const ElementMesh<ElementTrait>& element_mesh,
     const Eigen::Vector<Real, Eigen::Dynamic>& node_artificial_viscosity) {
-  tbb::parallel_for(tbb::blocked_range<Isize>(0, this->number_), [&](const tbb::blocked_range<Isize>& range) {
+  parallelFor(0, this->number_, [&](const tbb::blocked_range<Isize>& range) {
     for (Isize i = range.begin(); i != range.end(); i++) {
       for (Isize j = 0; j < ElementTrait::kBasicNodeNumber; j++) {
         this->element_(i).variable_artificial_viscosity_(j) =
@@ -194,16 +195,20 @@ inline void Solver<SimulationControl>::calculateArtificialViscosity(const Mesh<S
 template <typename ElementTrait, typename SimulationControl>
 inline void ElementSolver<ElementTrait, SimulationControl>::calculateElementQuadrature(
     const ElementMesh<ElementTrait>& element_mesh, [[maybe_unused]] const SourceTerm<SimulationControl>& source_term,
-    const PhysicalModel<SimulationControl>& physical_model) {
-  tbb::parallel_for(tbb::blocked_range<Isize>(0, this->number_), [&](const tbb::blocked_range<Isize>& range) {
+    const PhysicalModel<SimulationControl>& physical_model, const bool quadrature_variable_cache) {
+  parallelFor(0, this->number_, [&](const tbb::blocked_range<Isize>& range) {
     for (Isize i = range.begin(); i != range.end(); i++) {
       ElementVariable<ElementTrait, SimulationControl> quadrature_node_variable;
       [[maybe_unused]] ElementVariableGradient<ElementTrait, SimulationControl> quadrature_node_variable_gradient;
       [[maybe_unused]] ElementVariableGradient<ElementTrait, SimulationControl>
           quadrature_node_variable_volume_gradient;
       [[maybe_unused]] Eigen::Vector<Real, ElementTrait::kQuadratureNumber> quadrature_node_artificial_viscosity;
-      quadrature_node_variable.get(element_mesh, *this, i);
-      quadrature_node_variable.calculateComputationalFromConserved(physical_model);
+      if (quadrature_variable_cache) {
+        quadrature_node_variable = this->quadrature_node_variable_cache_(i);
+      } else {
+        quadrature_node_variable.get(element_mesh, *this, i);
+        quadrature_node_variable.calculateComputationalFromConserved(physical_model);
+      }
       if constexpr (IsNS<SimulationControl::kEquationModel>) {
         quadrature_node_variable_gradient.template get<SimulationControl::kViscousFlux>(element_mesh, *this, i);
         quadrature_node_variable_gradient.calculatePrimitiveFromConserved(physical_model, quadrature_node_variable);
@@ -270,34 +275,44 @@ inline void Solver<SimulationControl>::calculateQuadrature(
     const Mesh<SimulationControl>& mesh, [[maybe_unused]] const SourceTerm<SimulationControl>& source_term,
     const PhysicalModel<SimulationControl>& physical_model) {
   if constexpr (SimulationControl::kDimension == 1) {
-    this->line_.calculateElementQuadrature(mesh.line_, source_term, physical_model);
+    this->line_.calculateElementQuadrature(mesh.line_, source_term, physical_model, this->quadrature_variable_cache_);
   } else if constexpr (SimulationControl::kDimension == 2) {
     if constexpr (HasTriangle<SimulationControl::kMeshModel>) {
-      this->triangle_.calculateElementQuadrature(mesh.triangle_, source_term, physical_model);
+      this->triangle_.calculateElementQuadrature(mesh.triangle_, source_term, physical_model,
+                                                 this->quadrature_variable_cache_);
     }
     if constexpr (HasQuadrangle<SimulationControl::kMeshModel>) {
-      this->quadrangle_.calculateElementQuadrature(mesh.quadrangle_, source_term, physical_model);
+      this->quadrangle_.calculateElementQuadrature(mesh.quadrangle_, source_term, physical_model,
+                                                   this->quadrature_variable_cache_);
     }
   } else if constexpr (SimulationControl::kDimension == 3) {
     if constexpr (HasTetrahedron<SimulationControl::kMeshModel>) {
-      this->tetrahedron_.calculateElementQuadrature(mesh.tetrahedron_, source_term, physical_model);
+      this->tetrahedron_.calculateElementQuadrature(mesh.tetrahedron_, source_term, physical_model,
+                                                    this->quadrature_variable_cache_);
     }
     if constexpr (HasPyramid<SimulationControl::kMeshModel>) {
-      this->pyramid_.calculateElementQuadrature(mesh.pyramid_, source_term, physical_model);
+      this->pyramid_.calculateElementQuadrature(mesh.pyramid_, source_term, physical_model,
+                                                this->quadrature_variable_cache_);
     }
     if constexpr (HasHexahedron<SimulationControl::kMeshModel>) {
-      this->hexahedron_.calculateElementQuadrature(mesh.hexahedron_, source_term, physical_model);
+      this->hexahedron_.calculateElementQuadrature(mesh.hexahedron_, source_term, physical_model,
+                                                   this->quadrature_variable_cache_);
     }
   }
 }
 
 template <typename ElementTrait, typename SimulationControl>
 inline void ElementSolver<ElementTrait, SimulationControl>::calculateElementGardientQuadrature(
-    const ElementMesh<ElementTrait>& element_mesh) {
-  tbb::parallel_for(tbb::blocked_range<Isize>(0, this->number_), [&](const tbb::blocked_range<Isize>& range) {
+    const ElementMesh<ElementTrait>& element_mesh, const PhysicalModel<SimulationControl>& physical_model,
+    const bool quadrature_variable_cache) {
+  parallelFor(0, this->number_, [&](const tbb::blocked_range<Isize>& range) {
     for (Isize i = range.begin(); i != range.end(); i++) {
       ElementVariable<ElementTrait, SimulationControl> quadrature_node_variable;
       quadrature_node_variable.get(element_mesh, *this, i);
+      if (quadrature_variable_cache) {
+        quadrature_node_variable.calculateComputationalFromConserved(physical_model);
+        this->quadrature_node_variable_cache_(i) = quadrature_node_variable;
+      }
       for (Isize j = 0; j < ElementTrait::kQuadratureNumber; j++) {
         const Eigen::Matrix<Real, ElementTrait::kDimension, ElementTrait::kDimension>
             quadrature_node_jacobian_transpose_inverse_mutiply_deteminate_and_weight =
@@ -322,25 +337,31 @@ inline void ElementSolver<ElementTrait, SimulationControl>::calculateElementGard
 }
 
 template <typename SimulationControl>
-inline void Solver<SimulationControl>::calculateGardientQuadrature(const Mesh<SimulationControl>& mesh) {
+inline void Solver<SimulationControl>::calculateGardientQuadrature(
+    const Mesh<SimulationControl>& mesh, const PhysicalModel<SimulationControl>& physical_model) {
   if constexpr (SimulationControl::kDimension == 1) {
-    this->line_.calculateElementGardientQuadrature(mesh.line_);
+    this->line_.calculateElementGardientQuadrature(mesh.line_, physical_model, this->quadrature_variable_cache_);
   } else if constexpr (SimulationControl::kDimension == 2) {
     if constexpr (HasTriangle<SimulationControl::kMeshModel>) {
-      this->triangle_.calculateElementGardientQuadrature(mesh.triangle_);
+      this->triangle_.calculateElementGardientQuadrature(mesh.triangle_, physical_model,
+                                                         this->quadrature_variable_cache_);
     }
     if constexpr (HasQuadrangle<SimulationControl::kMeshModel>) {
-      this->quadrangle_.calculateElementGardientQuadrature(mesh.quadrangle_);
+      this->quadrangle_.calculateElementGardientQuadrature(mesh.quadrangle_, physical_model,
+                                                           this->quadrature_variable_cache_);
     }
   } else if constexpr (SimulationControl::kDimension == 3) {
     if constexpr (HasTetrahedron<SimulationControl::kMeshModel>) {
-      this->tetrahedron_.calculateElementGardientQuadrature(mesh.tetrahedron_);
+      this->tetrahedron_.calculateElementGardientQuadrature(mesh.tetrahedron_, physical_model,
+                                                            this->quadrature_variable_cache_);
     }
     if constexpr (HasPyramid<SimulationControl::kMeshModel>) {
-      this->pyramid_.calculateElementGardientQuadrature(mesh.pyramid_);
+      this->pyramid_.calculateElementGardientQuadrature(mesh.pyramid_, physical_model,
+                                                        this->quadrature_variable_cache_);
     }
     if constexpr (HasHexahedron<SimulationControl::kMeshModel>) {
-      this->hexahedron_.calculateElementGardientQuadrature(mesh.hexahedron_);
+      this->hexahedron_.calculateElementGardientQuadrature(mesh.hexahedron_, physical_model,
+                                                           this->quadrature_variable_cache_);
     }
   }
 }
@@ -637,7 +658,7 @@ AdjacencyElementSolver<AdjacencyElementTrait, SimulationControl>::calculateInter
     Solver<SimulationControl>& solver) {
   const AdjacencyElementMesh<AdjacencyElementTrait>& adjacency_element_mesh =
       mesh.*(std::remove_reference<decltype(mesh)>::type::template getAdjacencyElement<AdjacencyElementTrait>());
-  tbb::parallel_for(tbb::blocked_range<Isize>(0, this->interior_number_), [&](const tbb::blocked_range<Isize>& range) {
+  parallelFor(0, this->interior_number_, [&](const tbb::blocked_range<Isize>& range) {
     for (Isize i = range.begin(); i != range.end(); i++) {
       const Isize adjacency_right_rotation = adjacency_element_mesh.element_(i).adjacency_right_rotation_;
       const std::array<int, AdjacencyElementTrait::kQuadratureNumber> adjacency_element_quadrature_sequence{
@@ -670,12 +691,17 @@ AdjacencyElementSolver<AdjacencyElementTrait, SimulationControl>::calculateInter
           left_quadrature_node_artificial_viscosity;
       [[maybe_unused]] Eigen::Vector<Real, AdjacencyElementTrait::kQuadratureNumber>
           right_quadrature_node_artificial_viscosity;
-      left_quadrature_node_variable.get(mesh, solver, parent_gmsh_type_number(0), parent_index_each_type(0),
-                                        adjacency_sequence_in_parent(0));
-      right_quadrature_node_variable.get(mesh, solver, parent_gmsh_type_number(1), parent_index_each_type(1),
-                                         adjacency_sequence_in_parent(1));
-      left_quadrature_node_variable.calculateComputationalFromConserved(physical_model);
-      right_quadrature_node_variable.calculateComputationalFromConserved(physical_model);
+      if (solver.quadrature_variable_cache_) {
+        left_quadrature_node_variable = this->left_quadrature_node_variable_cache_(i);
+        right_quadrature_node_variable = this->right_quadrature_node_variable_cache_(i);
+      } else {
+        left_quadrature_node_variable.get(mesh, solver, parent_gmsh_type_number(0), parent_index_each_type(0),
+                                          adjacency_sequence_in_parent(0));
+        right_quadrature_node_variable.get(mesh, solver, parent_gmsh_type_number(1), parent_index_each_type(1),
+                                           adjacency_sequence_in_parent(1));
+        left_quadrature_node_variable.calculateComputationalFromConserved(physical_model);
+        right_quadrature_node_variable.calculateComputationalFromConserved(physical_model);
+      }
       if constexpr (IsNS<SimulationControl::kEquationModel>) {
         left_quadrature_node_variable_gradient.template get<SimulationControl::kViscousFlux>(
             mesh, solver, parent_gmsh_type_number(0), parent_index_each_type(0), adjacency_sequence_in_parent(0));
@@ -754,8 +780,8 @@ AdjacencyElementSolver<AdjacencyElementTrait, SimulationControl>::calculateBound
     const BoundaryCondition<SimulationControl>& boundary_condition, Solver<SimulationControl>& solver) {
   const AdjacencyElementMesh<AdjacencyElementTrait>& adjacency_element_mesh =
       mesh.*(std::remove_reference<decltype(mesh)>::type::template getAdjacencyElement<AdjacencyElementTrait>());
-  tbb::parallel_for(
-      tbb::blocked_range<Isize>(this->interior_number_, this->interior_number_ + this->boundary_number_),
+  parallelFor(
+      this->interior_number_, this->interior_number_ + this->boundary_number_,
       [&](const tbb::blocked_range<Isize>& range) {
         for (Isize i = range.begin(); i != range.end(); i++) {
           const Isize parent_index_each_type = adjacency_element_mesh.element_(i).parent_index_each_type_(0);
@@ -773,9 +799,13 @@ AdjacencyElementSolver<AdjacencyElementTrait, SimulationControl>::calculateBound
               left_quadrature_node_variable_volume_gradient;
           [[maybe_unused]] Eigen::Vector<Real, AdjacencyElementTrait::kQuadratureNumber>
               left_quadrature_node_artificial_viscosity;
-          left_quadrature_node_variable.get(mesh, solver, parent_gmsh_type_number, parent_index_each_type,
-                                            adjacency_sequence_in_parent);
-          left_quadrature_node_variable.calculateComputationalFromConserved(physical_model);
+          if (solver.quadrature_variable_cache_) {
+            left_quadrature_node_variable = this->left_quadrature_node_variable_cache_(i);
+          } else {
+            left_quadrature_node_variable.get(mesh, solver, parent_gmsh_type_number, parent_index_each_type,
+                                              adjacency_sequence_in_parent);
+            left_quadrature_node_variable.calculateComputationalFromConserved(physical_model);
+          }
           if constexpr (IsNS<SimulationControl::kEquationModel>) {
             left_quadrature_node_variable_gradient.template get<SimulationControl::kViscousFlux>(
                 mesh, solver, parent_gmsh_type_number, parent_index_each_type, adjacency_sequence_in_parent);
@@ -844,10 +874,11 @@ AdjacencyElementSolver<AdjacencyElementTrait, SimulationControl>::calculateBound
 template <typename AdjacencyElementTrait, typename SimulationControl>
 inline void
 AdjacencyElementSolver<AdjacencyElementTrait, SimulationControl>::calculateInteriorAdjacencyElementGardientQuadrature(
-    const Mesh<SimulationControl>& mesh, Solver<SimulationControl>& solver) {
+    const Mesh<SimulationControl>& mesh, const PhysicalModel<SimulationControl>& physical_model,
+    Solver<SimulationControl>& solver) {
   const AdjacencyElementMesh<AdjacencyElementTrait>& adjacency_element_mesh =
       mesh.*(std::remove_reference<decltype(mesh)>::type::template getAdjacencyElement<AdjacencyElementTrait>());
-  tbb::parallel_for(tbb::blocked_range<Isize>(0, this->interior_number_), [&](const tbb::blocked_range<Isize>& range) {
+  parallelFor(0, this->interior_number_, [&](const tbb::blocked_range<Isize>& range) {
     for (Isize i = range.begin(); i != range.end(); i++) {
       const Isize adjacency_right_rotation = adjacency_element_mesh.element_(i).adjacency_right_rotation_;
       const std::array<int, AdjacencyElementTrait::kQuadratureNumber> adjacency_element_quadrature_sequence{
@@ -872,6 +903,12 @@ AdjacencyElementSolver<AdjacencyElementTrait, SimulationControl>::calculateInter
                                         adjacency_sequence_in_parent(0));
       right_quadrature_node_variable.get(mesh, solver, parent_gmsh_type_number(1), parent_index_each_type(1),
                                          adjacency_sequence_in_parent(1));
+      if (solver.quadrature_variable_cache_) {
+        left_quadrature_node_variable.calculateComputationalFromConserved(physical_model);
+        right_quadrature_node_variable.calculateComputationalFromConserved(physical_model);
+        this->left_quadrature_node_variable_cache_(i) = left_quadrature_node_variable;
+        this->right_quadrature_node_variable_cache_(i) = right_quadrature_node_variable;
+      }
       for (Isize j = 0; j < AdjacencyElementTrait::kQuadratureNumber; j++) {
         FluxVariable<SimulationControl> gardient_flux;
         calculateVolumeGardientFlux(adjacency_element_mesh.element_(i).normal_vector_.col(j),
@@ -917,8 +954,8 @@ AdjacencyElementSolver<AdjacencyElementTrait, SimulationControl>::calculateBound
     const BoundaryCondition<SimulationControl>& boundary_condition, Solver<SimulationControl>& solver) {
   const AdjacencyElementMesh<AdjacencyElementTrait>& adjacency_element_mesh =
       mesh.*(std::remove_reference<decltype(mesh)>::type::template getAdjacencyElement<AdjacencyElementTrait>());
-  tbb::parallel_for(
-      tbb::blocked_range<Isize>(this->interior_number_, this->interior_number_ + this->boundary_number_),
+  parallelFor(
+      this->interior_number_, this->interior_number_ + this->boundary_number_,
       [&](const tbb::blocked_range<Isize>& range) {
         for (Isize i = range.begin(); i != range.end(); i++) {
           const Isize parent_index_each_type = adjacency_element_mesh.element_(i).parent_index_each_type_(0);
@@ -932,6 +969,9 @@ AdjacencyElementSolver<AdjacencyElementTrait, SimulationControl>::calculateBound
           left_quadrature_node_variable.get(mesh, solver, parent_gmsh_type_number, parent_index_each_type,
                                             adjacency_sequence_in_parent);
           left_quadrature_node_variable.calculateComputationalFromConserved(physical_model);
+          if (solver.quadrature_variable_cache_) {
+            this->left_quadrature_node_variable_cache_(i) = left_quadrature_node_variable;
+          }
           for (Isize j = 0; j < AdjacencyElementTrait::kQuadratureNumber; j++) {
             Variable<SimulationControl, 1> boundary_quadrature_node_volume_gradient_variable;
             Variable<SimulationControl, 1> boundary_quadrature_node_interface_gradient_variable;
@@ -994,19 +1034,19 @@ inline void Solver<SimulationControl>::calculateAdjacencyGardientQuadrature(
     const Mesh<SimulationControl>& mesh, const PhysicalModel<SimulationControl>& physical_model,
     const BoundaryCondition<SimulationControl>& boundary_condition) {
   if constexpr (SimulationControl::kDimension == 1) {
-    this->point_.calculateInteriorAdjacencyElementGardientQuadrature(mesh, *this);
+    this->point_.calculateInteriorAdjacencyElementGardientQuadrature(mesh, physical_model, *this);
     this->point_.calculateBoundaryAdjacencyElementGardientQuadrature(mesh, physical_model, boundary_condition, *this);
   } else if constexpr (SimulationControl::kDimension == 2) {
-    this->line_.calculateInteriorAdjacencyElementGardientQuadrature(mesh, *this);
+    this->line_.calculateInteriorAdjacencyElementGardientQuadrature(mesh, physical_model, *this);
     this->line_.calculateBoundaryAdjacencyElementGardientQuadrature(mesh, physical_model, boundary_condition, *this);
   } else if constexpr (SimulationControl::kDimension == 3) {
     if constexpr (HasAdjacencyTriangle<SimulationControl::kMeshModel>) {
-      this->triangle_.calculateInteriorAdjacencyElementGardientQuadrature(mesh, *this);
+      this->triangle_.calculateInteriorAdjacencyElementGardientQuadrature(mesh, physical_model, *this);
       this->triangle_.calculateBoundaryAdjacencyElementGardientQuadrature(mesh, physical_model, boundary_condition,
                                                                           *this);
     }
     if constexpr (HasAdjacencyQuadrangle<SimulationControl::kMeshModel>) {
-      this->quadrangle_.calculateInteriorAdjacencyElementGardientQuadrature(mesh, *this);
+      this->quadrangle_.calculateInteriorAdjacencyElementGardientQuadrature(mesh, physical_model, *this);
       this->quadrangle_.calculateBoundaryAdjacencyElementGardientQuadrature(mesh, physical_model, boundary_condition,
                                                                             *this);
     }
@@ -1016,7 +1056,7 @@ inline void Solver<SimulationControl>::calculateAdjacencyGardientQuadrature(
 template <typename ElementTrait, typename SimulationControl>
 inline void ElementSolver<ElementTrait, SimulationControl>::calculateElementResidual(
     const ElementMesh<ElementTrait>& element_mesh) {
-  tbb::parallel_for(tbb::blocked_range<Isize>(0, this->number_), [&](const tbb::blocked_range<Isize>& range) {
+  parallelFor(0, this->number_, [&](const tbb::blocked_range<Isize>& range) {
     for (Isize i = range.begin(); i != range.end(); i++) {
       // NOTE: Here we split the calculation to trigger eigen's noalias to avoid intermediate variables.
       this->element_(i).variable_residual_.noalias() =
@@ -1037,7 +1077,7 @@ inline void ElementSolver<ElementTrait, SimulationControl>::calculateElementGard
   [[maybe_unused]] constexpr std::array<int,
                                         ElementTrait::kAdjacencyNumber + 1> kElementAccumulateAdjacencyQuadratureNumber{
       getElementAccumulateAdjacencyQuadratureNumber<ElementTrait::kElementType, SimulationControl::kPolynomialOrder>()};
-  tbb::parallel_for(tbb::blocked_range<Isize>(0, this->number_), [&](const tbb::blocked_range<Isize>& range) {
+  parallelFor(0, this->number_, [&](const tbb::blocked_range<Isize>& range) {
     for (Isize i = range.begin(); i != range.end(); i++) {
       this->element_(i).variable_volume_gradient_residual_.noalias() =
           this->element_(i).variable_volume_gradient_adjacency_quadrature_ *
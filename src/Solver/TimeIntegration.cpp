@@ -15,8 +15,10 @@
 
 #include <Eigen/Core>
 #include <array>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "Mesh/ReadControl.cpp"
 #include "Solver/BoundaryCondition.cpp"
@@ -28,6 +30,7 @@
 #include "Utils/Concept.cpp"
 #include "Utils/Constant.cpp"
 #include "Utils/Enum.cpp"
+#include "Utils/ParallelControl.cpp"
 
 namespace SubrosaDG {
 
@@ -69,7 +72,7 @@ struct TimeIntegration : TimeIntegrationData<SimulationControl::kTimeIntegration
 
 template <typename ElementTrait, typename SimulationControl>
 inline void ElementSolver<ElementTrait, SimulationControl>::copyElementBasisFunctionCoefficient() {
-  tbb::parallel_for(tbb::blocked_range<Isize>(0, this->number_), [&](const tbb::blocked_range<Isize>& range) {
+  parallelFor(0, this->number_, [&](const tbb::blocked_range<Isize>& range) {
     for (Isize i = range.begin(); i != range.end(); i++) {
       this->element_(i).variable_basis_function_coefficient_last_.noalias() =
           this->element_(i).variable_basis_function_coefficient_;
@@ -106,7 +109,7 @@ inline void ElementSolver<ElementTrait, SimulationControl>::calculateElementDelt
     const ElementMesh<ElementTrait>& element_mesh, const PhysicalModel<SimulationControl>& physical_model,
     const Real courant_friedrichs_lewy_number, Real& delta_time) {
   tbb::combinable<Real> min_delta_time_combinable(kRealMax);
-  tbb::parallel_for(tbb::blocked_range<Isize>(0, this->number_), [&](const tbb::blocked_range<Isize>& range) {
+  parallelFor(0, this->number_, [&](const tbb::blocked_range<Isize>& range) {
     for (Isize i = range.begin(); i != range.end(); i++) {
       ElementVariable<ElementTrait, SimulationControl> quadrature_node_variable;
       Eigen::Vector<Real, ElementTrait::kQuadratureNumber> local_delta_time;
@@ -182,7 +185,7 @@ template <typename ElementTrait, typename SimulationControl>
 inline void ElementSolver<ElementTrait, SimulationControl>::updateElementBasisFunctionCoefficient(
     const int rk_step, const ElementMesh<ElementTrait>& element_mesh,
     const TimeIntegration<SimulationControl>& time_integration) {
-  tbb::parallel_for(tbb::blocked_range<Isize>(0, this->number_), [&](const tbb::blocked_range<Isize>& range) {
+  parallelFor(0, this->number_, [&](const tbb::blocked_range<Isize>& range) {
     for (Isize i = range.begin(); i != range.end(); i++) {
       // NOTE: Here we split the calculation to trigger eigen's noalias to avoid intermediate variables.
       this->element_(i).variable_basis_function_coefficient_ *=
@@ -200,7 +203,7 @@ inline void ElementSolver<ElementTrait, SimulationControl>::updateElementBasisFu
 template <typename ElementTrait, typename SimulationControl>
 inline void ElementSolver<ElementTrait, SimulationControl>::updateElementGardientBasisFunctionCoefficient(
     const ElementMesh<ElementTrait>& element_mesh) {
-  tbb::parallel_for(tbb::blocked_range<Isize>(0, this->number_), [&](const tbb::blocked_range<Isize>& range) {
+  parallelFor(0, this->number_, [&](const tbb::blocked_range<Isize>& range) {
     for (Isize i = range.begin(); i != range.end(); i++) {
       this->element_(i).variable_volume_gradient_basis_function_coefficient_.noalias() =
           this->element_(i).variable_volume_gradient_residual_ * element_mesh.element_(i).local_mass_matrix_inverse_;
@@ -282,7 +285,7 @@ inline void ElementSolver<ElementTrait, SimulationControl>::calculateElementRela
     Eigen::Vector<Real, SimulationControl::kConservedVariableNumber>& relative_error) {
   tbb::combinable<Eigen::Vector<Real, SimulationControl::kConservedVariableNumber>> relative_error_combinable(
       Eigen::Vector<Real, SimulationControl::kConservedVariableNumber>::Zero());
-  tbb::parallel_for(tbb::blocked_range<Isize>(0, this->number_), [&](const tbb::blocked_range<Isize>& range) {
+  parallelFor(0, this->number_, [&](const tbb::blocked_range<Isize>& range) {
     for (Isize i = range.begin(); i != range.end(); i++) {
       relative_error_combinable.local().array() +=
           (this->element_(i).variable_residual_ * element_mesh.basis_function_.modal_value_.transpose())
@@ -323,6 +326,157 @@ inline void Solver<SimulationControl>::calculateRelativeError(const Mesh<Simulat
   this->relative_error_ = this->relative_error_ / static_cast<Real>(mesh.element_number_);
 }
 
+template <typename SimulationControl>
+template <typename ElementTrait>
+inline void Solver<SimulationControl>::addElementStepTask(const Mesh<SimulationControl>& mesh,
+                                                          const SourceTerm<SimulationControl>& source_term,
+                                                          const PhysicalModel<SimulationControl>& physical_model,
+                                                          const TimeIntegration<SimulationControl>& time_integration,
+                                                          std::vector<ElementStepTask>& element_step_task) {
+  ElementSolver<ElementTrait, SimulationControl>& element_solver = this->*(this->template getElement<ElementTrait>());
+  const ElementMesh<ElementTrait>& element_mesh = mesh.*(Mesh<SimulationControl>::template getElement<ElementTrait>());
+  element_step_task.emplace_back(
+      [this, &element_solver, &element_mesh, &physical_model] {
+        element_solver.calculateElementGardientQuadrature(element_mesh, physical_model,
+                                                          this->quadrature_variable_cache_);
+      },
+      [this, &element_solver, &element_mesh, &source_term, &physical_model] {
+        element_solver.calculateElementGardientResidual(element_mesh);
+        element_solver.updateElementGardientBasisFunctionCoefficient(element_mesh);
+        element_solver.calculateElementQuadrature(element_mesh, source_term, physical_model,
+                                                  this->quadrature_variable_cache_);
+      },
+      [&element_solver, &element_mesh, &time_integration](const int rk_step) {
+        element_solver.calculateElementResidual(element_mesh);
+        element_solver.updateElementBasisFunctionCoefficient(rk_step, element_mesh, time_integration);
+      });
+}
+
+template <typename SimulationControl>
+template <typename AdjacencyElementTrait>
+inline void Solver<SimulationControl>::addAdjacencyElementStepTask(
+    const Mesh<SimulationControl>& mesh, const PhysicalModel<SimulationControl>& physical_model,
+    const BoundaryCondition<SimulationControl>& boundary_condition,
+    std::vector<AdjacencyElementStepTask>& adjacency_element_step_task) {
+  AdjacencyElementSolver<AdjacencyElementTrait, SimulationControl>& adjacency_element_solver =
+      this->*(this->template getAdjacencyElement<AdjacencyElementTrait>());
+  adjacency_element_step_task.emplace_back(
+      [this, &adjacency_element_solver, &mesh, &physical_model] {
+        adjacency_element_solver.calculateInteriorAdjacencyElementGardientQuadrature(mesh, physical_model, *this);
+      },
+      [this, &adjacency_element_solver, &mesh, &physical_model, &boundary_condition] {
+        adjacency_element_solver.calculateBoundaryAdjacencyElementGardientQuadrature(mesh, physical_model,
+                                                                                     boundary_condition, *this);
+      },
+      [this, &adjacency_element_solver, &mesh, &physical_model] {
+        adjacency_element_solver.calculateInteriorAdjacencyElementQuadrature(mesh, physical_model, *this);
+      },
+      [this, &adjacency_element_solver, &mesh, &physical_model, &boundary_condition] {
+        adjacency_element_solver.calculateBoundaryAdjacencyElementQuadrature(mesh, physical_model, boundary_condition,
+                                                                             *this);
+      });
+}
+
+// NOTE: Each element type only waits for its own previous kernel and for the adjacency kernels that write into it, so
+// the element types and the adjacency kernels overlap instead of meeting at a barrier after every sweep. The graph is
+// built once and its nodes keep references to the arguments, which live as long as the solver.
+template <typename SimulationControl>
+inline void Solver<SimulationControl>::initializeStepTaskGraph(
+    const Mesh<SimulationControl>& mesh, const SourceTerm<SimulationControl>& source_term,
+    const PhysicalModel<SimulationControl>& physical_model,
+    const BoundaryCondition<SimulationControl>& boundary_condition,
+    const TimeIntegration<SimulationControl>& time_integration) {
+  std::vector<ElementStepTask>& element_step_task = this->element_step_task_;
+  std::vector<AdjacencyElementStepTask>& adjacency_element_step_task = this->adjacency_element_step_task_;
+  element_step_task.clear();
+  adjacency_element_step_task.clear();
+  if constexpr (SimulationControl::kDimension == 1) {
+    this->addElementStepTask<LineTrait<SimulationControl::kPolynomialOrder>>(mesh, source_term, physical_model,
+                                                                             time_integration, element_step_task);
+    this->addAdjacencyElementStepTask<AdjacencyPointTrait<SimulationControl::kPolynomialOrder>>(
+        mesh, physical_model, boundary_condition, adjacency_element_step_task);
+  } else if constexpr (SimulationControl::kDimension == 2) {
+    if constexpr (HasTriangle<SimulationControl::kMeshModel>) {
+      this->addElementStepTask<TriangleTrait<SimulationControl::kPolynomialOrder>>(
+          mesh, source_term, physical_model, time_integration, element_step_task);
+    }
+    if constexpr (HasQuadrangle<SimulationControl::kMeshModel>) {
+      this->addElementStepTask<QuadrangleTrait<SimulationControl::kPolynomialOrder>>(
+          mesh, source_term, physical_model, time_integration, element_step_task);
+    }
+    this->addAdjacencyElementStepTask<AdjacencyLineTrait<SimulationControl::kPolynomialOrder>>(
+        mesh, physical_model, boundary_condition, adjacency_element_step_task);
+  } else if constexpr (SimulationControl::kDimension == 3) {
+    if constexpr (HasTetrahedron<SimulationControl::kMeshModel>) {
+      this->addElementStepTask<TetrahedronTrait<SimulationControl::kPolynomialOrder>>(
+          mesh, source_term, physical_model, time_integration, element_step_task);
+    }
+    if constexpr (HasPyramid<SimulationControl::kMeshModel>) {
+      this->addElementStepTask<PyramidTrait<SimulationControl::kPolynomialOrder>>(
+          mesh, source_term, physical_model, time_integration, element_step_task);
+    }
+    if constexpr (HasHexahedron<SimulationControl::kMeshModel>) {
+      this->addElementStepTask<HexahedronTrait<SimulationControl::kPolynomialOrder>>(
+          mesh, source_term, physical_model, time_integration, element_step_task);
+    }
+    if constexpr (HasAdjacencyTriangle<SimulationControl::kMeshModel>) {
+      this->addAdjacencyElementStepTask<AdjacencyTriangleTrait<SimulationControl::kPolynomialOrder>>(
+          mesh, physical_model, boundary_condition, adjacency_element_step_task);
+    }
+    if constexpr (HasAdjacencyQuadrangle<SimulationControl::kMeshModel>) {
+      this->addAdjacencyElementStepTask<AdjacencyQuadrangleTrait<SimulationControl::kPolynomialOrder>>(
+          mesh, physical_model, boundary_condition, adjacency_element_step_task);
+    }
+  }
+  this->step_task_graph_node_ = std::make_unique<TaskGraph>();
+  TaskGraph& task_graph = *this->step_task_graph_node_;
+  std::vector<TaskNode*> update_node;
+  for (int i = 0; i < time_integration.kStep; i++) {
+    std::vector<TaskNode*> adjacency_gardient_quadrature_node;
+    for (const AdjacencyElementStepTask& task : adjacency_element_step_task) {
+      adjacency_gardient_quadrature_node.emplace_back(
+          task_graph.addNode(update_node, task.interior_gardient_quadrature_));
+      adjacency_gardient_quadrature_node.emplace_back(
+          task_graph.addNode(update_node, task.boundary_gardient_quadrature_));
+    }
+    std::vector<TaskNode*> quadrature_node;
+    for (Usize j = 0; j < element_step_task.size(); j++) {
+      std::vector<TaskNode*> gardient_quadrature_predecessor;
+      if (!update_node.empty()) {
+        gardient_quadrature_predecessor.emplace_back(update_node[j]);
+      }
+      std::vector<TaskNode*> predecessor = adjacency_gardient_quadrature_node;
+      predecessor.emplace_back(
+          task_graph.addNode(gardient_quadrature_predecessor, element_step_task[j].gardient_quadrature_));
+      quadrature_node.emplace_back(task_graph.addNode(predecessor, element_step_task[j].quadrature_));
+    }
+    std::vector<TaskNode*> adjacency_quadrature_node;
+    for (const AdjacencyElementStepTask& task : adjacency_element_step_task) {
+      adjacency_quadrature_node.emplace_back(task_graph.addNode(quadrature_node, task.interior_quadrature_));
+      adjacency_quadrature_node.emplace_back(task_graph.addNode(quadrature_node, task.boundary_quadrature_));
+    }
+    update_node.clear();
+    for (Usize j = 0; j < element_step_task.size(); j++) {
+      std::vector<TaskNode*> predecessor = adjacency_quadrature_node;
+      predecessor.emplace_back(quadrature_node[j]);
+      update_node.emplace_back(
+          task_graph.addNode(predecessor, [this, i, j] { this->element_step_task_[j].update_(i); }));
+    }
+  }
+}
+
+template <typename SimulationControl>
+inline void Solver<SimulationControl>::stepSolverTaskGraph(
+    const Mesh<SimulationControl>& mesh, const SourceTerm<SimulationControl>& source_term,
+    const PhysicalModel<SimulationControl>& physical_model,
+    const BoundaryCondition<SimulationControl>& boundary_condition,
+    const TimeIntegration<SimulationControl>& time_integration) {
+  if (this->step_task_graph_node_ == nullptr) {
+    this->initializeStepTaskGraph(mesh, source_term, physical_model, boundary_condition, time_integration);
+  }
+  this->step_task_graph_node_->run();
+}
+
 template <typename SimulationControl>
 inline void Solver<SimulationControl>::stepSolver(const Mesh<SimulationControl>& mesh,
                                                   [[maybe_unused]] const SourceTerm<SimulationControl>& source_term,
@@ -336,15 +490,19 @@ inline void Solver<SimulationControl>::stepSolver(const Mesh<SimulationControl>&
   if constexpr (SimulationControl::kShockCapturing == ShockCapturingEnum::ArtificialViscosity) {
     this->calculateArtificialViscosity(mesh);
   }
-  for (int i = 0; i < time_integration.kStep; i++) {
-    this->calculateGardientQuadrature(mesh);
-    this->calculateAdjacencyGardientQuadrature(mesh, physical_model, boundary_condition);
-    this->calculateGardientResidual(mesh);
-    this->updateGardientBasisFunctionCoefficient(mesh);
-    this->calculateQuadrature(mesh, source_term, physical_model);
-    this->calculateAdjacencyQuadrature(mesh, physical_model, boundary_condition);
-    this->calculateResidual(mesh);
-    this->updateBasisFunctionCoefficient(i, mesh, time_integration);
+  if (this->step_task_graph_) {
+    this->stepSolverTaskGraph(mesh, source_term, physical_model, boundary_condition, time_integration);
+  } else {
+    for (int i = 0; i < time_integration.kStep; i++) {
+      this->calculateGardientQuadrature(mesh, physical_model);
+      this->calculateAdjacencyGardientQuadrature(mesh, physical_model, boundary_condition);
+      this->calculateGardientResidual(mesh);
+      this->updateGardientBasisFunctionCoefficient(mesh);
+      this->calculateQuadrature(mesh, source_term, physical_model);
+      this->calculateAdjacencyQuadrature(mesh, physical_model, boundary_condition);
+      this->calculateResidual(mesh);
+      this->updateBasisFunctionCoefficient(i, mesh, time_integration);
+    }
   }
   this->calculateRelativeError(mesh);
 }
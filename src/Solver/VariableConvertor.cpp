@@ -238,6 +238,12 @@ struct Variable {
         column);
   }
 
+  template <ComputationalVariableEnum ComputationalVariableType>
+  [[nodiscard]] inline auto getRow() const {
+    return this->computational_.row(getComputationalVariableIndex<SimulationControl, ComputationalVariableType>())
+        .array();
+  }
+
   template <PrimitiveVariableEnum PrimitiveVariableType>
   [[nodiscard]] inline Real getScalar(const Isize column) const {
     return this->primitive_(getPrimitiveVariableIndex<SimulationControl, PrimitiveVariableType>(), column);
@@ -517,6 +523,14 @@ struct VariableGradient {
         column);
   }
 
+  template <PrimitiveVariableEnum PrimitiveVariableType, VariableGradientEnum VariableGradientType>
+  [[nodiscard]] inline auto getRow() const {
+    return this->primitive_
+        .row(getPrimitiveVariableIndex<SimulationControl, PrimitiveVariableType>() * SimulationControl::kDimension +
+             getVariableGradientIndex<VariableGradientType>())
+        .array();
+  }
+
   template <PrimitiveVariableEnum PrimitiveVariableType>
   [[nodiscard]] inline Eigen::Vector<Real, SimulationControl::kDimension> getVector(const Isize column) const {
     return this->primitive_(
@@ -620,6 +634,16 @@ struct VariableGradient {
   }
 };
 
+// NOTE: The viscous stress with the Stokes hypothesis, used by the viscous flux, the force of the view and the force
+// monitor.
+template <int Dimension>
+inline Eigen::Matrix<Real, Dimension, Dimension> calculateViscousStress(
+    const Real dynamic_viscosity, const Eigen::Matrix<Real, Dimension, Dimension>& velocity_gradient) {
+  return dynamic_viscosity * (velocity_gradient + velocity_gradient.transpose()) -
+         2.0_r / 3.0_r * dynamic_viscosity * velocity_gradient.trace() *
+             Eigen::Matrix<Real, Dimension, Dimension>::Identity();
+}
+
 template <typename ElementTrait, typename SimulationControl>
 struct ElementVariableGradient : VariableGradient<SimulationControl, ElementTrait::kQuadratureNumber> {
   template <ViscousFluxEnum ViscousFluxType>
@@ -753,131 +777,147 @@ struct ViewVariableData<ElementTrait, SimulationControl, EquationModelEnum::Inco
 
 template <typename ElementTrait, typename SimulationControl>
 struct ViewVariable : ViewVariableData<ElementTrait, SimulationControl, SimulationControl::kEquationModel> {
-  [[nodiscard]] inline Real get(const PhysicalModel<SimulationControl>& physical_model,
-                                const ViewVariableEnum variable_type, const Isize column) const {
+  [[nodiscard]] inline Eigen::Array<Real, 1, ElementTrait::kBasisFunctionNumber> getSoundSpeed(
+      const PhysicalModel<SimulationControl>& physical_model) const {
+    return this->variable_.template getRow<ComputationalVariableEnum::Density>().binaryExpr(
+        this->variable_.template getRow<ComputationalVariableEnum::Pressure>(),
+        [&physical_model](const Real density, const Real pressure) {
+          return physical_model.calculateSoundSpeedFromDensityPressure(density, pressure);
+        });
+  }
+
+  // NOTE: Each view variable is computed for all nodes of the element at once. The sound speed is shared by several
+  // outputs and is computed once per element by the caller.
+  inline void getRow(const PhysicalModel<SimulationControl>& physical_model, const ViewVariableEnum variable_type,
+                     const Eigen::Array<Real, 1, ElementTrait::kBasisFunctionNumber>& sound_speed,
+                     Eigen::Array<Real, 1, ElementTrait::kBasisFunctionNumber>& row) const {
     switch (variable_type) {
     case ViewVariableEnum::Density:
-      return this->variable_.template getScalar<ComputationalVariableEnum::Density>(column);
+      row = this->variable_.template getRow<ComputationalVariableEnum::Density>();
+      return;
     case ViewVariableEnum::Velocity:
-      return std::sqrt(this->variable_.template getScalar<ComputationalVariableEnum::VelocitySquaredNorm>(column));
+      row = this->getVelocityNorm();
+      return;
     case ViewVariableEnum::Temperature:
-      return physical_model.calculateTemperatureFromInternalEnergy(
-          this->variable_.template getScalar<ComputationalVariableEnum::InternalEnergy>(column));
+      row = this->variable_.template getRow<ComputationalVariableEnum::InternalEnergy>().unaryExpr(
+          [&physical_model](const Real internal_energy) {
+            return physical_model.calculateTemperatureFromInternalEnergy(internal_energy);
+          });
+      return;
     case ViewVariableEnum::Pressure:
-      return this->variable_.template getScalar<ComputationalVariableEnum::Pressure>(column);
+      row = this->variable_.template getRow<ComputationalVariableEnum::Pressure>();
+      return;
     case ViewVariableEnum::SoundSpeed:
-      return physical_model.calculateSoundSpeedFromDensityPressure(
-          this->variable_.template getScalar<ComputationalVariableEnum::Density>(column),
-          this->variable_.template getScalar<ComputationalVariableEnum::Pressure>(column));
+      row = sound_speed;
+      return;
     case ViewVariableEnum::MachNumber:
-      return std::sqrt(this->variable_.template getScalar<ComputationalVariableEnum::VelocitySquaredNorm>(column)) /
-             physical_model.calculateSoundSpeedFromDensityPressure(
-                 this->variable_.template getScalar<ComputationalVariableEnum::Density>(column),
-                 this->variable_.template getScalar<ComputationalVariableEnum::Pressure>(column));
+      row = this->getVelocityNorm() / sound_speed;
+      return;
     case ViewVariableEnum::Entropy:
       if constexpr (IsCompresible<SimulationControl::kEquationModel>) {
-        return physical_model.calculateEntropyFromDensityPressure(
-            this->variable_.template getScalar<ComputationalVariableEnum::Density>(column),
-            this->variable_.template getScalar<ComputationalVariableEnum::Pressure>(column));
+        row = this->variable_.template getRow<ComputationalVariableEnum::Density>().binaryExpr(
+            this->variable_.template getRow<ComputationalVariableEnum::Pressure>(),
+            [&physical_model](const Real density, const Real pressure) {
+              return physical_model.calculateEntropyFromDensityPressure(density, pressure);
+            });
+        return;
       }
+      break;
     case ViewVariableEnum::Vorticity:
-      if constexpr (IsNS<SimulationControl::kEquationModel>) {
-        if constexpr (SimulationControl::kDimension == 2) {
-          return this->variable_gradient_.template getScalar<PrimitiveVariableEnum::VelocityY, VariableGradientEnum::X>(
-                     column) -
-                 this->variable_gradient_.template getScalar<PrimitiveVariableEnum::VelocityX, VariableGradientEnum::Y>(
-                     column);
-        }
-        if constexpr (SimulationControl::kDimension == 3) {
-          return std::sqrt(
-              (this->variable_gradient_.template getScalar<PrimitiveVariableEnum::VelocityZ, VariableGradientEnum::Y>(
-                   column) -
-               this->variable_gradient_.template getScalar<PrimitiveVariableEnum::VelocityY, VariableGradientEnum::Z>(
-                   column)) *
-                  (this->variable_gradient_
-                       .template getScalar<PrimitiveVariableEnum::VelocityZ, VariableGradientEnum::Y>(column) -
-                   this->variable_gradient_
-                       .template getScalar<PrimitiveVariableEnum::VelocityY, VariableGradientEnum::Z>(column)) +
-              (this->variable_gradient_.template getScalar<PrimitiveVariableEnum::VelocityX, VariableGradientEnum::Z>(
-                   column) -
-               this->variable_gradient_.template getScalar<PrimitiveVariableEnum::VelocityZ, VariableGradientEnum::X>(
-                   column)) *
-                  (this->variable_gradient_
-                       .template getScalar<PrimitiveVariableEnum::VelocityX, VariableGradientEnum::Z>(column) -
-                   this->variable_gradient_
-                       .template getScalar<PrimitiveVariableEnum::VelocityZ, VariableGradientEnum::X>(column)) +
-              (this->variable_gradient_.template getScalar<PrimitiveVariableEnum::VelocityY, VariableGradientEnum::X>(
-                   column) -
-               this->variable_gradient_.template getScalar<PrimitiveVariableEnum::VelocityX, VariableGradientEnum::Y>(
-                   column)) *
-                  (this->variable_gradient_
-                       .template getScalar<PrimitiveVariableEnum::VelocityY, VariableGradientEnum::X>(column) -
-                   this->variable_gradient_
-                       .template getScalar<PrimitiveVariableEnum::VelocityX, VariableGradientEnum::Y>(column)));
-        }
+      if constexpr (IsNS<SimulationControl::kEquationModel> && SimulationControl::kDimension == 2) {
+        row = this->variable_gradient_.template getRow<PrimitiveVariableEnum::VelocityY, VariableGradientEnum::X>() -
+              this->variable_gradient_.template getRow<PrimitiveVariableEnum::VelocityX, VariableGradientEnum::Y>();
+        return;
       }
+      if constexpr (IsNS<SimulationControl::kEquationModel> && SimulationControl::kDimension == 3) {
+        row = ((this->variable_gradient_.template getRow<PrimitiveVariableEnum::VelocityZ, VariableGradientEnum::Y>() -
+                this->variable_gradient_.template getRow<PrimitiveVariableEnum::VelocityY, VariableGradientEnum::Z>())
+                   .square() +
+               (this->variable_gradient_.template getRow<PrimitiveVariableEnum::VelocityX, VariableGradientEnum::Z>() -
+                this->variable_gradient_.template getRow<PrimitiveVariableEnum::VelocityZ, VariableGradientEnum::X>())
+                   .square() +
+               (this->variable_gradient_.template getRow<PrimitiveVariableEnum::VelocityY, VariableGradientEnum::X>() -
+                this->variable_gradient_.template getRow<PrimitiveVariableEnum::VelocityX, VariableGradientEnum::Y>())
+                   .square())
+                  .sqrt();
+        return;
+      }
+      break;
     case ViewVariableEnum::ArtificialViscosity:
-      return this->artificial_viscosity_(column);
+      row = this->artificial_viscosity_.transpose().array();
+      return;
     case ViewVariableEnum::VelocityX:
-      return this->variable_.template getScalar<ComputationalVariableEnum::VelocityX>(column);
+      row = this->variable_.template getRow<ComputationalVariableEnum::VelocityX>();
+      return;
     case ViewVariableEnum::VelocityY:
-      return this->variable_.template getScalar<ComputationalVariableEnum::VelocityY>(column);
+      row = this->variable_.template getRow<ComputationalVariableEnum::VelocityY>();
+      return;
     case ViewVariableEnum::VelocityZ:
-      return this->variable_.template getScalar<ComputationalVariableEnum::VelocityZ>(column);
+      row = this->variable_.template getRow<ComputationalVariableEnum::VelocityZ>();
+      return;
     case ViewVariableEnum::MachNumberX:
-      return this->variable_.template getScalar<ComputationalVariableEnum::VelocityX>(column) /
-             physical_model.calculateSoundSpeedFromDensityPressure(
-                 this->variable_.template getScalar<ComputationalVariableEnum::Density>(column),
-                 this->variable_.template getScalar<ComputationalVariableEnum::Pressure>(column));
+      row = this->variable_.template getRow<ComputationalVariableEnum::VelocityX>() / sound_speed;
+      return;
     case ViewVariableEnum::MachNumberY:
-      return this->variable_.template getScalar<ComputationalVariableEnum::VelocityY>(column) /
-             physical_model.calculateSoundSpeedFromDensityPressure(
-                 this->variable_.template getScalar<ComputationalVariableEnum::Density>(column),
-                 this->variable_.template getScalar<ComputationalVariableEnum::Pressure>(column));
+      row = this->variable_.template getRow<ComputationalVariableEnum::VelocityY>() / sound_speed;
+      return;
     case ViewVariableEnum::MachNumberZ:
-      return this->variable_.template getScalar<ComputationalVariableEnum::VelocityZ>(column) /
-             physical_model.calculateSoundSpeedFromDensityPressure(
-                 this->variable_.template getScalar<ComputationalVariableEnum::Density>(column),
-                 this->variable_.template getScalar<ComputationalVariableEnum::Pressure>(column));
+      row = this->variable_.template getRow<ComputationalVariableEnum::VelocityZ>() / sound_speed;
+      return;
     case ViewVariableEnum::VorticityX:
       if constexpr (IsNS<SimulationControl::kEquationModel>) {
-        return this->variable_gradient_.template getScalar<PrimitiveVariableEnum::VelocityZ, VariableGradientEnum::Y>(
-                   column) -
-               this->variable_gradient_.template getScalar<PrimitiveVariableEnum::VelocityY, VariableGradientEnum::Z>(
-                   column);
+        row = this->variable_gradient_.template getRow<PrimitiveVariableEnum::VelocityZ, VariableGradientEnum::Y>() -
+              this->variable_gradient_.template getRow<PrimitiveVariableEnum::VelocityY, VariableGradientEnum::Z>();
+        return;
       }
+      break;
     case ViewVariableEnum::VorticityY:
       if constexpr (IsNS<SimulationControl::kEquationModel>) {
-        return this->variable_gradient_.template getScalar<PrimitiveVariableEnum::VelocityX, VariableGradientEnum::Z>(
-                   column) -
-               this->variable_gradient_.template getScalar<PrimitiveVariableEnum::VelocityZ, VariableGradientEnum::X>(
-                   column);
+        row = this->variable_gradient_.template getRow<PrimitiveVariableEnum::VelocityX, VariableGradientEnum::Z>() -
+              this->variable_gradient_.template getRow<PrimitiveVariableEnum::VelocityZ, VariableGradientEnum::X>();
+        return;
       }
+      break;
     case ViewVariableEnum::VorticityZ:
       if constexpr (IsNS<SimulationControl::kEquationModel>) {
-        return this->variable_gradient_.template getScalar<PrimitiveVariableEnum::VelocityY, VariableGradientEnum::X>(
-                   column) -
-               this->variable_gradient_.template getScalar<PrimitiveVariableEnum::VelocityX, VariableGradientEnum::Y>(
-                   column);
+        row = this->variable_gradient_.template getRow<PrimitiveVariableEnum::VelocityY, VariableGradientEnum::X>() -
+              this->variable_gradient_.template getRow<PrimitiveVariableEnum::VelocityX, VariableGradientEnum::Y>();
+        return;
       }
+      break;
     case ViewVariableEnum::HeatFluxX:
       if constexpr (IsNS<SimulationControl::kEquationModel>) {
-        return this->variable_gradient_.template getScalar<PrimitiveVariableEnum::Temperature, VariableGradientEnum::X>(
-            column);
+        row = this->variable_gradient_.template getRow<PrimitiveVariableEnum::Temperature, VariableGradientEnum::X>();
+        return;
       }
+      break;
     case ViewVariableEnum::HeatFluxY:
       if constexpr (IsNS<SimulationControl::kEquationModel>) {
-        return this->variable_gradient_.template getScalar<PrimitiveVariableEnum::Temperature, VariableGradientEnum::Y>(
-            column);
+        row = this->variable_gradient_.template getRow<PrimitiveVariableEnum::Temperature, VariableGradientEnum::Y>();
+        return;
       }
+      break;
     case ViewVariableEnum::HeatFluxZ:
       if constexpr (IsNS<SimulationControl::kEquationModel>) {
-        return this->variable_gradient_.template getScalar<PrimitiveVariableEnum::Temperature, VariableGradientEnum::Z>(
-            column);
+        row = this->variable_gradient_.template getRow<PrimitiveVariableEnum::Temperature, VariableGradientEnum::Z>();
+        return;
       }
+      break;
     default:
-      return 0.0_r;
+      break;
     }
+    row.setZero();
+  }
+
+  [[nodiscard]] inline Eigen::Array<Real, 1, ElementTrait::kBasisFunctionNumber> getVelocityNorm() const {
+    return this->variable_.computational_(
+                   Eigen::seqN(Eigen::fix<getComputationalVariableIndex<SimulationControl,
+                                                                        ComputationalVariableEnum::Velocity>()>,
+                               Eigen::fix<SimulationControl::kDimension>),
+                   Eigen::all)
+        .colwise()
+        .norm()
+        .array();
   }
 
   inline Eigen::Vector<Real, SimulationControl::kDimension> getForce(
@@ -893,9 +933,7 @@ struct ViewVariable : ViewVariableData<ElementTrait, SimulationControl, Simulati
           this->variable_.template getScalar<ComputationalVariableEnum::InternalEnergy>(column));
       const Real dynamic_viscosity = physical_model.calculateDynamicViscosity(tempurature);
       const Eigen::Matrix<Real, SimulationControl::kDimension, SimulationControl::kDimension> viscous_stress =
-          dynamic_viscosity * (velocity_gradient + velocity_gradient.transpose()) -
-          2.0_r / 3.0_r * dynamic_viscosity * velocity_gradient.trace() *
-              Eigen::Matrix<Real, SimulationControl::kDimension, SimulationControl::kDimension>::Identity();
+          calculateViscousStress(dynamic_viscosity, velocity_gradient);
       return (this->variable_.template getScalar<ComputationalVariableEnum::Pressure>(column) *
                   Eigen::Matrix<Real, SimulationControl::kDimension, SimulationControl::kDimension>::Identity() -
               viscous_stress) *
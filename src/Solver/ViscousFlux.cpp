@@ -69,9 +69,7 @@ inline void calculateViscousRawFlux(const PhysicalModel<SimulationControl>& phys
         variable.template getScalar<ComputationalVariableEnum::InternalEnergy>(column));
     const Real dynamic_viscosity = physical_model.calculateDynamicViscosity(tempurature);
     const Eigen::Matrix<Real, SimulationControl::kDimension, SimulationControl::kDimension> viscous_stress =
-        dynamic_viscosity * (velocity_gradient + velocity_gradient.transpose()) -
-        2.0_r / 3.0_r * dynamic_viscosity * velocity_gradient.trace() *
-            Eigen::Matrix<Real, SimulationControl::kDimension, SimulationControl::kDimension>::Identity();
+        calculateViscousStress(dynamic_viscosity, velocity_gradient);
     viscous_raw_flux.template setMatrix<ConservedVariableEnum::Momentum>(viscous_stress);
     const Eigen::Vector<Real, SimulationControl::kDimension>& velocity =
         variable.template getVector<ComputationalVariableEnum::Velocity>(column);
@@ -90,9 +88,7 @@ inline void calculateViscousRawFlux(const PhysicalModel<SimulationControl>& phys
         variable.template getScalar<ComputationalVariableEnum::InternalEnergy>(column));
     const Real dynamic_viscosity = physical_model.calculateDynamicViscosity(tempurature);
     const Eigen::Matrix<Real, SimulationControl::kDimension, SimulationControl::kDimension> viscous_stress =
-        dynamic_viscosity * (velocity_gradient + velocity_gradient.transpose()) -
-        2.0_r / 3.0_r * dynamic_viscosity * velocity_gradient.trace() *
-            Eigen::Matrix<Real, SimulationControl::kDimension, SimulationControl::kDimension>::Identity();
+        calculateViscousStress(dynamic_viscosity, velocity_gradient);
     viscous_raw_flux.template setMatrix<ConservedVariableEnum::Momentum>(viscous_stress);
     const Real thermal_conductivity = physical_model.calculateThermalConductivity(tempurature);
     const Eigen::Vector<Real, SimulationControl::kDimension>& tempurature_gradient =
@@ -54,12 +54,20 @@
 #include "Utils/Constant.cpp"
 #include "Utils/Enum.cpp"
 #include "Utils/Environment.cpp"
+#include "Utils/ParallelControl.cpp"
 #include "Utils/SystemControl.cpp"
 #include "Utils/Version.cpp"
 #include "View/CommandLine.cpp"
+#include "View/ForceMonitor.cpp"
 #include "View/IOControl.cpp"
+#include "View/OutputSubset.cpp"
 #include "View/Paraview.cpp"
+#include "View/Probe.cpp"
 #include "View/RawBinary.cpp"
+#include "View/RawBinaryCompress.cpp"
+#include "View/Statistics.cpp"
+#include "View/VtuWriter.cpp"
+#include "View/XdmfWriter.cpp"
 
 // clang-format on
 
@@ -87,6 +87,7 @@ enum class InitialConditionEnum {
   Function,
   SpecificFile,
   LastStep,
+  MeshTransfer,
 };
 
 enum class BoundaryConditionEnum {
@@ -232,6 +233,30 @@ enum class ViewVariableEnum {
   HeatFluxZ,
 };
 
+enum class ViewWriteModeEnum {
+  RawBinaryCompressed,
+  RawBinary,
+};
+
+enum class ViewFormatEnum {
+  Vtu,
+  Xdmf,
+};
+
+enum class RawBinaryTypeEnum {
+  Full,
+  Compact,
+  Quantized,
+  Subset,
+};
+
+enum class RawBinaryBlockEnum {
+  Element,
+  BoundaryAdjacencyElement,
+  NodeArtificialViscosity,
+  ElementIndex,
+};
+
 }  // namespace SubrosaDG
 
 #endif  // SUBROSA_DG_ENUM_CPP_
@@ -13,35 +13,95 @@
 #ifndef SUBROSA_DG_ENVIRONMENT_CPP_
 #define SUBROSA_DG_ENVIRONMENT_CPP_
 
-#include <../opt/compiler/include/omp.h>
 #include <gmsh.h>
 #include <oneapi/tbb/global_control.h>
+#include <oneapi/tbb/info.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string_view>
+#include <system_error>
 
 #include "Cmake.cpp"
 
 namespace SubrosaDG {
 
 struct Environment {
+  int thread_number_;
+  int view_thread_number_;
+  std::unique_ptr<oneapi::tbb::global_control> global_control_;
+
+  inline void setThreadNumber(int thread_number, int view_thread_number = 0);
+
   inline Environment();
 
+  inline Environment(int argc, char* argv[]);
+
   inline ~Environment();
 };
 
-inline Environment::Environment() {
+inline int getThreadNumber(const std::string_view thread_number_string, const int default_thread_number) {
+  int thread_number = 0;
+  const std::from_chars_result result = std::from_chars(
+      thread_number_string.data(), thread_number_string.data() + thread_number_string.size(), thread_number);
+  if (result.ec != std::errc() || thread_number <= 0) [[unlikely]] {
+    std::cout << "Invalid thread number: " << thread_number_string << ", use " << default_thread_number << '\n';
+    return default_thread_number;
+  }
+  return thread_number;
+}
+
+inline int getEnvironmentThreadNumber(const char* environment_variable, const int default_thread_number) {
+  const char* thread_number_string = std::getenv(environment_variable);
+  if (thread_number_string == nullptr) {
+    return default_thread_number;
+  }
+  return getThreadNumber(thread_number_string, default_thread_number);
+}
+
+inline void Environment::setThreadNumber(const int thread_number, const int view_thread_number) {
+  this->thread_number_ = std::ranges::max(thread_number, 1);
+  this->view_thread_number_ = view_thread_number > 0 ? std::ranges::min(view_thread_number, this->thread_number_)
+                                                     : std::ranges::max(this->thread_number_ / 2, 1);
+  // NOTE: Release the old limit first, the active value of global_control is the most restrictive one alive.
+  this->global_control_.reset();
+  this->global_control_ = std::make_unique<oneapi::tbb::global_control>(
+      oneapi::tbb::global_control::max_allowed_parallelism, static_cast<std::size_t>(this->thread_number_));
+  gmsh::option::setNumber("General.NumThreads", this->thread_number_);
+}
+
+inline Environment::Environment() : Environment(0, nullptr) {}
+
+inline Environment::Environment(const int argc, char* argv[]) {
   gmsh::initialize();
 #ifdef SUBROSA_DG_DEVELOP
-  oneapi::tbb::global_control global_limit(oneapi::tbb::global_control::max_allowed_parallelism, 1);
-  omp_set_num_threads(1);
-  gmsh::option::setNumber("General.NumThreads", 1);
+  int thread_number = getEnvironmentThreadNumber("SUBROSA_DG_NUM_THREADS", 1);
 #else   // SUBROSA_DG_DEVELOP
-  oneapi::tbb::global_control global_limit(oneapi::tbb::global_control::max_allowed_parallelism,
-                                           kNumberOfPhysicalCores - 1);
-  omp_set_num_threads(kNumberOfPhysicalCores - 1);
-  gmsh::option::setNumber("General.NumThreads", kNumberOfPhysicalCores - 1);
+  // NOTE: default_concurrency respects the process affinity mask, so a job given part of a node only uses that part.
+  int thread_number = getEnvironmentThreadNumber("SUBROSA_DG_NUM_THREADS",
+                                                 std::ranges::max(oneapi::tbb::info::default_concurrency() - 1, 1));
 #endif  // SUBROSA_DG_DEVELOP
+  int view_thread_number = getEnvironmentThreadNumber("SUBROSA_DG_VIEW_NUM_THREADS", 0);
+  for (int i = 1; i < argc; i++) {
+    const std::string_view argument{argv[i]};
+    if (argument.starts_with("--threads=")) {
+      thread_number = getThreadNumber(argument.substr(std::string_view{"--threads="}.size()), thread_number);
+    } else if (argument.starts_with("--view-threads=")) {
+      view_thread_number =
+          getThreadNumber(argument.substr(std::string_view{"--view-threads="}.size()), view_thread_number);
+    }
+  }
+  this->setThreadNumber(thread_number, view_thread_number);
 }
 
-inline Environment::~Environment() { gmsh::finalize(); }
+inline Environment::~Environment() {
+  this->global_control_.reset();
+  gmsh::finalize();
+}
 
 }  // namespace SubrosaDG
 
@@ -0,0 +1,156 @@
+/**
+ * @file ParallelControl.cpp
+ * @brief The header file of SubrosaDG parallel control.
+ *
+ * @author Yufei.Liu, Calm.Liu@outlook.com | Chenyu.Bao, bcynuaa@163.com
+ * @date 2025-04-07
+ *
+ * @version 0.1.0
+ * @copyright Copyright (c) 2022 - 2025 by SubrosaDG developers. All rights reserved.
+ * SubrosaDG is free software and is distributed under the MIT license.
+ */
+
+#ifndef SUBROSA_DG_PARALLEL_CONTROL_CPP_
+#define SUBROSA_DG_PARALLEL_CONTROL_CPP_
+
+#include <oneapi/tbb.h>
+#include <oneapi/tbb/flow_graph.h>
+#include <oneapi/tbb/info.h>
+#include <oneapi/tbb/task_arena.h>
+#include <oneapi/tbb/task_group.h>
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "Utils/BasicDataType.cpp"
+
+namespace SubrosaDG {
+
+#ifdef SUBROSA_DG_NUMA
+inline std::vector<oneapi::tbb::task_arena>& getNumaTaskArena() {
+  static std::vector<oneapi::tbb::task_arena> numa_task_arena = [] {
+    const std::vector<oneapi::tbb::numa_node_id> numa_node = oneapi::tbb::info::numa_nodes();
+    std::vector<oneapi::tbb::task_arena> task_arena(numa_node.size());
+    for (Usize i = 0; i < numa_node.size(); i++) {
+      task_arena[i].initialize(oneapi::tbb::task_arena::constraints(numa_node[i]));
+    }
+    return task_arena;
+  }();
+  return numa_task_arena;
+}
+
+inline bool& getNumaParallelScope() {
+  thread_local bool is_numa_parallel{false};
+  return is_numa_parallel;
+}
+#endif  // SUBROSA_DG_NUMA
+
+// NOTE: Only the thread that drives the solver splits a loop over the NUMA arenas, and only outside of any task. A loop
+// of a view arena, of a task graph node or nested in another loop stays in the arena of its caller, so it keeps the
+// thread limit of that arena and a worker never blocks on the NUMA arenas.
+struct NumaParallelScope {
+#ifdef SUBROSA_DG_NUMA
+  bool previous_;
+
+  explicit inline NumaParallelScope(const bool is_numa_parallel)
+      : previous_(std::exchange(getNumaParallelScope(), is_numa_parallel)) {}
+
+  inline ~NumaParallelScope() { getNumaParallelScope() = this->previous_; }
+#else   // SUBROSA_DG_NUMA
+  explicit inline NumaParallelScope([[maybe_unused]] const bool is_numa_parallel) {}
+#endif  // SUBROSA_DG_NUMA
+
+  NumaParallelScope(const NumaParallelScope&) = delete;
+  NumaParallelScope& operator=(const NumaParallelScope&) = delete;
+};
+
+// NOTE: Split the range into one contiguous block per NUMA node and use a static partitioner inside each block, so the
+// same index always lands on the same node and the pages touched first stay local.
+template <typename Function>
+inline void parallelFor(const Isize begin, const Isize end, const Function& function) {
+#ifdef SUBROSA_DG_NUMA
+  std::vector<oneapi::tbb::task_arena>& numa_task_arena = getNumaTaskArena();
+  const auto numa_number = static_cast<Isize>(numa_task_arena.size());
+  if (numa_number <= 1) {
+    oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<Isize>(begin, end), function,
+                              oneapi::tbb::static_partitioner());
+    return;
+  }
+  if (!getNumaParallelScope()) {
+    oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<Isize>(begin, end), function);
+    return;
+  }
+  const auto numa_function = [&function](const oneapi::tbb::blocked_range<Isize>& range) {
+    const NumaParallelScope numa_parallel_scope(false);
+    function(range);
+  };
+  const Isize block_size = (end - begin + numa_number - 1) / numa_number;
+  std::vector<oneapi::tbb::task_group> task_group(static_cast<Usize>(numa_number));
+  for (Isize i = 0; i < numa_number; i++) {
+    const Isize block_begin = std::ranges::min(begin + i * block_size, end);
+    const Isize block_end = std::ranges::min(block_begin + block_size, end);
+    numa_task_arena[static_cast<Usize>(i)].execute([&, block_begin, block_end, i] {
+      task_group[static_cast<Usize>(i)].run([&numa_function, block_begin, block_end] {
+        oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<Isize>(block_begin, block_end), numa_function,
+                                  oneapi::tbb::static_partitioner());
+      });
+    });
+  }
+  for (Isize i = 0; i < numa_number; i++) {
+    numa_task_arena[static_cast<Usize>(i)].execute([&, i] { task_group[static_cast<Usize>(i)].wait(); });
+  }
+#else   // SUBROSA_DG_NUMA
+  oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<Isize>(begin, end), function);
+#endif  // SUBROSA_DG_NUMA
+}
+
+// NOTE: Touch the memory right after resize with the same decomposition as parallelFor, so each page is placed on the
+// node that will work on it.
+template <typename T>
+inline void parallelFirstTouch([[maybe_unused]] Eigen::Array<T, Eigen::Dynamic, 1>& array) {
+#ifdef SUBROSA_DG_NUMA
+  parallelFor(0, static_cast<Isize>(array.size()), [&](const oneapi::tbb::blocked_range<Isize>& range) {
+    std::memset(static_cast<void*>(array.data() + range.begin()), 0,
+                static_cast<std::size_t>(range.size()) * sizeof(T));
+  });
+#endif  // SUBROSA_DG_NUMA
+}
+
+using TaskNode = oneapi::tbb::flow::continue_node<oneapi::tbb::flow::continue_msg>;
+
+// NOTE: A node without predecessor starts as soon as the graph runs, others start once all their predecessors finish.
+struct TaskGraph {
+  oneapi::tbb::flow::graph graph_;
+  oneapi::tbb::flow::broadcast_node<oneapi::tbb::flow::continue_msg> start_node_{graph_};
+  std::deque<TaskNode> node_;
+
+  inline TaskNode* addNode(const std::vector<TaskNode*>& predecessor, const std::function<void()>& function) {
+    TaskNode& node = this->node_.emplace_back(this->graph_, [function](const oneapi::tbb::flow::continue_msg& message) {
+      const NumaParallelScope numa_parallel_scope(false);
+      function();
+      return message;
+    });
+    if (predecessor.empty()) {
+      oneapi::tbb::flow::make_edge(this->start_node_, node);
+    }
+    for (TaskNode* predecessor_node : predecessor) {
+      oneapi::tbb::flow::make_edge(*predecessor_node, node);
+    }
+    return &node;
+  }
+
+  inline void run() {
+    this->start_node_.try_put(oneapi::tbb::flow::continue_msg());
+    this->graph_.wait_for_all();
+  }
+};
+
+}  // namespace SubrosaDG
+
+#endif  // SUBROSA_DG_PARALLEL_CONTROL_CPP_
@@ -13,12 +13,17 @@
 #ifndef SUBROSA_DG_SYSTEM_CONTROL_CPP_
 #define SUBROSA_DG_SYSTEM_CONTROL_CPP_
 
+#include <oneapi/tbb.h>
+
 #include <Eigen/Core>
 #include <filesystem>
 #include <format>
 #include <functional>
-#include <future>
 #include <iostream>
+#include <magic_enum/magic_enum.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -33,9 +38,14 @@
 #include "Utils/BasicDataType.cpp"
 #include "Utils/Enum.cpp"
 #include "Utils/Environment.cpp"
+#include "Utils/ParallelControl.cpp"
 #include "View/CommandLine.cpp"
+#include "View/ForceMonitor.cpp"
 #include "View/IOControl.cpp"
+#include "View/OutputSubset.cpp"
+#include "View/Probe.cpp"
 #include "View/RawBinary.cpp"
+#include "View/Statistics.cpp"
 
 namespace SubrosaDG {
 
@@ -51,6 +61,11 @@ struct System {
   TimeIntegration<SimulationControl> time_integration_;
   Solver<SimulationControl> solver_;
   View<SimulationControl> view_;
+  InSituView<SimulationControl> in_situ_view_;
+  Probe<SimulationControl> probe_;
+  ForceMonitor<SimulationControl> force_monitor_;
+  Statistics<SimulationControl> statistics_;
+  std::vector<OutputSubset<SimulationControl>> output_subset_;
 
   inline void setMesh(const std::filesystem::path& mesh_file_path,
                       const std::function<void(const std::filesystem::path& mesh_file_path)>& generate_mesh_function) {
@@ -73,6 +88,14 @@ struct System {
     this->initial_condition_.raw_binary_path_ = initial_condition_file;
   }
 
+  template <InitialConditionEnum InitialConditionType>
+    requires(InitialConditionType == InitialConditionEnum::MeshTransfer)
+  inline void addInitialCondition(const std::filesystem::path& source_mesh_file,
+                                  const std::filesystem::path& initial_condition_file) {
+    this->initial_condition_.source_mesh_path_ = source_mesh_file;
+    this->initial_condition_.raw_binary_path_ = initial_condition_file;
+  }
+
   template <BoundaryConditionEnum BoundaryConditionType>
   inline void addBoundaryCondition(const Isize physical_index) {
     this->mesh_.information_.physical_[static_cast<Usize>(physical_index) - 1].boundary_condition_type_ =
@@ -102,11 +125,147 @@ struct System {
     this->physical_model_.calculateThermalConductivityFromDynamicViscosity();
   }
 
+  inline void setThreadNumber(const int thread_number, const int view_thread_number = 0) {
+    this->environment_.setThreadNumber(thread_number, view_thread_number);
+  }
+
   inline void setArtificialViscosity(const Real empirical_tolerance, const Real artificial_viscosity_factor = 1.0_r) {
     this->solver_.empirical_tolerance_ = empirical_tolerance;
     this->solver_.artificial_viscosity_factor_ = artificial_viscosity_factor;
   }
 
+  inline void setQuadratureVariableCache(const bool quadrature_variable_cache) {
+    this->solver_.setQuadratureVariableCache(quadrature_variable_cache);
+  }
+
+  inline void setStepTaskGraph(const bool step_task_graph) { this->solver_.step_task_graph_ = step_task_graph; }
+
+  inline void setRawBinaryCompact(const bool raw_binary_compact) {
+    this->solver_.raw_binary_compact_ = raw_binary_compact;
+  }
+
+  // NOTE: Snapshots between checkpoints are only written for the view, a negative interval keeps the first and the last
+  // step as the only checkpoints.
+  inline void setRawBinaryQuantization(const Real tolerance, const int checkpoint_interval = -1) {
+    this->solver_.raw_binary_quantize_ = true;
+    this->solver_.raw_binary_quantize_tolerance_ = tolerance;
+    this->view_.checkpoint_interval_ = checkpoint_interval;
+  }
+
+  // NOTE: Reading a delta snapshot needs every snapshot back to its keyframe, so a long interval trades the view speed
+  // for a smaller output.
+  inline void setRawBinaryDelta(const int keyframe_interval) {
+    this->solver_.raw_binary_keyframe_interval_ = keyframe_interval;
+  }
+
+  inline void setViewWriteMode(const ViewWriteModeEnum write_mode, const int compression_level = kVtuCompressionLevel) {
+    this->view_.write_mode_ = write_mode;
+    this->view_.compression_level_ = compression_level;
+  }
+
+  // NOTE: The XDMF output writes the mesh of each physical group once and only the field arrays at every step, the
+  // partition number is ignored.
+  inline void setViewFormat(const ViewFormatEnum format) { this->view_.format_ = format; }
+
+  // NOTE: The incremental view only converts the steps whose output is missing or older than its raw binary file, the
+  // follow mode also waits for the snapshots of a running solve and stops after follow_timeout seconds without one.
+  inline void setViewIncremental(const bool is_follow = false, const int follow_timeout = 60,
+                                 const int follow_interval = 1) {
+    this->view_.is_incremental_ = true;
+    this->view_.is_follow_ = is_follow;
+    this->view_.follow_timeout_ = follow_timeout;
+    this->view_.follow_interval_ = follow_interval;
+  }
+
+  // NOTE: The probes are located once when the solve starts and sampled from the modal coefficients every interval
+  // steps into probe/<prefix>_probe.bin, so no snapshot is needed for them.
+  inline void addProbe(const std::vector<Eigen::Vector<Real, SimulationControl::kDimension>>& coordinate,
+                       const int interval = 1) {
+    if (interval <= 0) [[unlikely]] {
+      throw std::runtime_error(std::format("Probe interval {} is not positive.", interval));
+    }
+    for (const auto& probe_coordinate : coordinate) {
+      this->probe_.probe_.emplace_back().coordinate_ = probe_coordinate;
+    }
+    this->probe_.interval_ = interval;
+  }
+
+  // NOTE: A positive distribution interval also writes the pressure and skin friction coefficients on the monitored
+  // boundaries every distribution interval steps.
+  inline void addForceMonitor(const std::vector<Isize>& physical_index, const int interval = 1,
+                              const int distribution_interval = 0) {
+    if (interval <= 0) [[unlikely]] {
+      throw std::runtime_error(std::format("Force monitor interval {} is not positive.", interval));
+    }
+    if (distribution_interval < 0) [[unlikely]] {
+      throw std::runtime_error(std::format("Force distribution interval {} is negative.", distribution_interval));
+    }
+    this->force_monitor_.physical_index_ = physical_index;
+    this->force_monitor_.interval_ = interval;
+    this->force_monitor_.distribution_interval_ = distribution_interval;
+  }
+
+  inline void setForceReference(const Real reference_density, const Real reference_velocity,
+                                const Real reference_pressure, const Real reference_area, const Real reference_length,
+                                const Eigen::Vector<Real, SimulationControl::kDimension>& moment_center =
+                                    Eigen::Vector<Real, SimulationControl::kDimension>::Zero()) {
+    this->force_monitor_.reference_density_ = reference_density;
+    this->force_monitor_.reference_velocity_ = reference_velocity;
+    this->force_monitor_.reference_pressure_ = reference_pressure;
+    this->force_monitor_.reference_area_ = reference_area;
+    this->force_monitor_.reference_length_ = reference_length;
+    this->force_monitor_.moment_center_ = moment_center;
+  }
+
+  // NOTE: The means and the root mean squares of the density, the velocity components, the temperature and the pressure
+  // are always accumulated, each correlation pair adds the covariance of two of them, e.g. a Reynolds shear stress. The
+  // statistics are written to statistics/ every view interval and at the end.
+  inline void setStatistics(const int start_step, const int interval = 1,
+                            const std::vector<std::pair<ViewVariableEnum, ViewVariableEnum>>& correlation = {}) {
+    if (interval <= 0) [[unlikely]] {
+      throw std::runtime_error(std::format("Statistics interval {} is not positive.", interval));
+    }
+    this->statistics_.start_step_ = start_step;
+    this->statistics_.interval_ = interval;
+    this->statistics_.correlation_ = correlation;
+  }
+
+  // NOTE: An output subset writes the coefficients of the elements in the given physical groups, boxes given by their
+  // lower and upper corners and spheres given by their centers and radii to subset/ every io interval steps. The view
+  // writes each subset as a physical group named after it.
+  inline void addOutputSubset(
+      const std::string& name, const int io_interval, const std::vector<Isize>& physical_index,
+      const std::vector<std::pair<Eigen::Vector<Real, SimulationControl::kDimension>,
+                                  Eigen::Vector<Real, SimulationControl::kDimension>>>& box = {},
+      const std::vector<std::pair<Eigen::Vector<Real, SimulationControl::kDimension>, Real>>& sphere = {}) {
+    if (io_interval <= 0) [[unlikely]] {
+      throw std::runtime_error(std::format("Output subset {} interval {} is not positive.", name, io_interval));
+    }
+    OutputSubset<SimulationControl>& output_subset = this->output_subset_.emplace_back();
+    output_subset.name_ = name;
+    output_subset.io_interval_ = io_interval;
+    output_subset.physical_index_ = physical_index;
+    output_subset.box_ = box;
+    output_subset.sphere_ = sphere;
+  }
+
+  inline void setViewPartition(const int partition_number) { this->view_.partition_number_ = partition_number; }
+
+  // NOTE: Each buffer holds one snapshot and the output arrays of its physical groups, a non-positive number uses one
+  // buffer per view thread.
+  inline void setViewBufferNumber(const int buffer_number) { this->view_.buffer_number_ = buffer_number; }
+
+  inline void setInSituView(const int thread_number = 1, const int capacity = 1) {
+    this->in_situ_view_.is_open_ = true;
+    this->in_situ_view_.thread_number_ = thread_number;
+    this->in_situ_view_.capacity_ = static_cast<Usize>(capacity);
+  }
+
+  inline void setRawBinaryCompress(const int compression_level, const int queue_capacity = 2) {
+    this->solver_.raw_binary_write_queue_.compression_level_ = compression_level;
+    this->solver_.raw_binary_write_queue_.capacity_ = static_cast<Usize>(queue_capacity);
+  }
+
   inline void setTimeIntegration(const Real courant_friedrichs_lewy_number,
                                  const std::pair<int, int> iteration_range = {0, 0}) {
     if (iteration_range.first == 0 && iteration_range.second == 0) {
@@ -141,45 +300,143 @@ struct System {
 
   inline void addViewVariable(const std::vector<ViewVariableEnum>& view_variable) {
     this->view_.variable_type_ = view_variable;
+    this->view_.resolveViewVariable();
   }
 
   inline void synchronize() {
+    const NumaParallelScope numa_parallel_scope(true);
     this->mesh_.readMeshElement();
-    if constexpr (SimulationControl::kInitialCondition == InitialConditionEnum::SpecificFile) {
-      RawBinaryCompress::read(this->initial_condition_.raw_binary_path_, this->initial_condition_.raw_binary_ss_);
-    } else if constexpr (SimulationControl::kInitialCondition == InitialConditionEnum::LastStep) {
+    for (OutputSubset<SimulationControl>& output_subset : this->output_subset_) {
+      output_subset.initializeOutputSubset(this->mesh_);
+    }
+    if constexpr (SimulationControl::kInitialCondition == InitialConditionEnum::LastStep) {
       this->initial_condition_.raw_binary_path_ =
           this->view_.output_directory_ /
           std::format("raw/{}_{}.zst", this->view_.output_file_name_prefix_, this->time_integration_.iteration_start_);
-      RawBinaryCompress::read(this->initial_condition_.raw_binary_path_, this->initial_condition_.raw_binary_ss_);
     }
-    this->command_line_.printInformation();
+    if constexpr (SimulationControl::kInitialCondition == InitialConditionEnum::MeshTransfer) {
+      this->initial_condition_.initializeSourceMesh(this->mesh_.information_);
+    }
+    if constexpr (SimulationControl::kInitialCondition == InitialConditionEnum::SpecificFile ||
+                  SimulationControl::kInitialCondition == InitialConditionEnum::LastStep ||
+                  SimulationControl::kInitialCondition == InitialConditionEnum::MeshTransfer) {
+      RawBinaryCompress::readHeader(this->initial_condition_.raw_binary_path_,
+                                    this->initial_condition_.raw_binary_header_,
+                                    this->initial_condition_.raw_binary_block_);
+      checkRawBinary(this->initial_condition_.raw_binary_path_, this->initial_condition_.raw_binary_header_,
+                     this->initial_condition_.raw_binary_block_,
+                     SimulationControl::kInitialCondition == InitialConditionEnum::MeshTransfer
+                         ? this->initial_condition_.source_mesh_
+                         : this->mesh_,
+                     SimulationControl::kInitialCondition == InitialConditionEnum::SpecificFile
+                         ? SimulationControl::kPolynomialOrder - 1
+                         : SimulationControl::kPolynomialOrder,
+                     true);
+      RawBinaryCompress::read(this->initial_condition_.raw_binary_path_, this->initial_condition_.raw_binary_header_,
+                              this->initial_condition_.raw_binary_block_, this->initial_condition_.raw_binary_,
+                              [](const RawBinaryBlock& block) {
+                                return block.type_ == magic_enum::enum_integer(RawBinaryBlockEnum::Element);
+                              });
+    }
+    if constexpr (SimulationControl::kInitialCondition == InitialConditionEnum::MeshTransfer) {
+      this->initial_condition_.initializeSourceRawBinary();
+    }
+    this->command_line_.printInformation(this->environment_);
   }
 
   inline void solve(const bool delete_dir = true) {
+    const NumaParallelScope numa_parallel_scope(true);
     this->view_.initializeSolverFinout(delete_dir, this->solver_.error_finout_);
     this->solver_.initializeSolver(this->mesh_, this->physical_model_, this->boundary_condition_,
                                    this->initial_condition_);
+    if (this->solver_.step_task_graph_) {
+      this->solver_.initializeStepTaskGraph(this->mesh_, this->source_term_, this->physical_model_,
+                                            this->boundary_condition_, this->time_integration_);
+    }
     if (this->time_integration_.delta_time_ == 0.0_r) {
       this->solver_.calculateDeltaTime(this->mesh_, this->physical_model_, this->time_integration_);
     }
+    if (this->in_situ_view_.is_open_) {
+      this->view_.initializeInSituView(delete_dir, this->time_integration_.iteration_end_,
+                                       this->time_integration_.delta_time_);
+      this->view_.solver_.initialViewSolver(this->mesh_);
+      this->view_.initializeViewIndex(this->mesh_.information_);
+      this->view_.scheduleView(static_cast<Isize>(this->in_situ_view_.capacity_), this->in_situ_view_.thread_number_);
+    }
+    if (!this->probe_.probe_.empty()) {
+      this->probe_.initializeProbe(
+          this->mesh_,
+          this->view_.output_directory_ / std::format("probe/{}_probe.bin", this->view_.output_file_name_prefix_),
+          this->time_integration_.iteration_start_,
+          !delete_dir || SimulationControl::kInitialCondition == InitialConditionEnum::LastStep);
+    }
+    if (!this->force_monitor_.physical_index_.empty()) {
+      this->force_monitor_.initializeForceMonitor(
+          this->mesh_,
+          this->view_.output_directory_ / std::format("force/{}_force.bin", this->view_.output_file_name_prefix_),
+          this->view_.output_directory_ / "force", this->view_.output_file_name_prefix_,
+          this->time_integration_.iteration_start_,
+          !delete_dir || SimulationControl::kInitialCondition == InitialConditionEnum::LastStep);
+    }
+    if (this->statistics_.interval_ > 0) {
+      this->statistics_.initializeStatistics(
+          this->mesh_, this->view_.output_directory_ / "statistics", this->view_.output_file_name_prefix_,
+          this->time_integration_.iteration_start_,
+          !delete_dir || SimulationControl::kInitialCondition == InitialConditionEnum::LastStep);
+    }
+    if (!this->output_subset_.empty()) {
+      const std::filesystem::path subset_output_directory = this->view_.output_directory_ / "subset";
+      if (delete_dir && SimulationControl::kInitialCondition != InitialConditionEnum::LastStep &&
+          std::filesystem::exists(subset_output_directory)) {
+        std::filesystem::remove_all(subset_output_directory);
+      }
+      std::filesystem::create_directories(subset_output_directory);
+    }
     if constexpr (SimulationControl::kInitialCondition != InitialConditionEnum::LastStep) {
       this->solver_.writeRawBinary(
-          this->mesh_,
-          this->view_.output_directory_ / std::format("raw/{}_{}.zst", this->view_.output_file_name_prefix_, 0));
-    } else {
-      this->solver_.write_raw_binary_future_ = std::async(std::launch::async, []() {});
+          this->mesh_, this->time_integration_,
+          this->view_.output_directory_ / std::format("raw/{}_{}.zst", this->view_.output_file_name_prefix_, 0), true);
+      if (this->in_situ_view_.is_open_) {
+        this->stepInSituView(0);
+      }
+      if (this->probe_.is_open_) {
+        this->probe_.writeProbe(0, 0.0_r, this->solver_, this->physical_model_);
+      }
+      if (this->force_monitor_.is_open_) {
+        this->force_monitor_.writeForceMonitor(0, 0.0_r, this->mesh_, this->physical_model_, this->solver_);
+      }
+      this->writeOutputSubset(0);
     }
     this->command_line_.initializeSolver(this->time_integration_, this->solver_.error_finout_);
     for (int i = this->time_integration_.iteration_start_ + 1; i <= this->time_integration_.iteration_end_; i++) {
       this->solver_.stepSolver(this->mesh_, this->source_term_, this->physical_model_, this->boundary_condition_,
                                this->time_integration_);
       this->time_integration_.iteration_ = i;
+      if (this->probe_.is_open_ && i % this->probe_.interval_ == 0) {
+        this->probe_.writeProbe(i, static_cast<Real>(i) * this->time_integration_.delta_time_, this->solver_,
+                                this->physical_model_);
+      }
+      if (this->force_monitor_.is_open_ && i % this->force_monitor_.interval_ == 0) {
+        this->force_monitor_.writeForceMonitor(i, static_cast<Real>(i) * this->time_integration_.delta_time_,
+                                               this->mesh_, this->physical_model_, this->solver_);
+      }
+      if (this->statistics_.is_open_) {
+        this->statistics_.accumulateStatistics(i, this->mesh_, this->physical_model_, this->solver_);
+      }
+      this->writeOutputSubset(i);
       if (i % this->view_.io_interval_ == 0) [[unlikely]] {
-        this->solver_.write_raw_binary_future_.get();
         this->solver_.writeRawBinary(
-            this->mesh_,
-            this->view_.output_directory_ / std::format("raw/{}_{}.zst", this->view_.output_file_name_prefix_, i));
+            this->mesh_, this->time_integration_,
+            this->view_.output_directory_ / std::format("raw/{}_{}.zst", this->view_.output_file_name_prefix_, i),
+            i == this->time_integration_.iteration_end_ ||
+                (this->view_.checkpoint_interval_ > 0 && i % this->view_.checkpoint_interval_ == 0));
+        if (this->in_situ_view_.is_open_) {
+          this->stepInSituView(i);
+        }
+        if (this->statistics_.is_open_) {
+          this->statistics_.writeStatistics(this->time_integration_.delta_time_, this->mesh_, this->view_.solver_,
+                                            this->view_.write_mode_, this->view_.compression_level_);
+        }
       }
       this->command_line_.updateSolver(i, this->solver_.relative_error_, this->solver_.error_finout_);
       if (this->solver_.relative_error_.array().isNaN().all()) [[unlikely]] {
@@ -190,49 +447,222 @@ struct System {
         break;
       }
     }
-    this->solver_.write_raw_binary_future_.get();
+    this->solver_.raw_binary_write_queue_.wait();
+    if (this->in_situ_view_.is_open_) {
+      this->in_situ_view_.wait();
+      // NOTE: A restarted solve keeps the view files of the earlier run, the collection starts from step 0 so they
+      // stay in the series.
+      this->view_.writeViewCollection(this->mesh_.information_, 0, this->time_integration_.iteration_end_);
+    }
+    this->probe_.finalizeProbe();
+    this->force_monitor_.finalizeForceMonitor();
+    this->statistics_.finalizeStatistics(this->time_integration_.delta_time_, this->mesh_, this->view_.solver_,
+                                         this->view_.write_mode_, this->view_.compression_level_);
     this->view_.finalizeSolverFinout(this->solver_.error_finout_);
   }
 
+  inline void writeOutputSubset(const int step) {
+    for (OutputSubset<SimulationControl>& output_subset : this->output_subset_) {
+      if (step % output_subset.io_interval_ == 0) {
+        output_subset.writeRawBinary(
+            this->mesh_, this->time_integration_, this->solver_,
+            output_subset.getRawBinaryPath(this->view_.output_directory_, this->view_.output_file_name_prefix_, step));
+      }
+    }
+  }
+
+  // NOTE: Only the copy of the solver state is made on the solver thread, the view variables and the files are computed
+  // on the in-situ arena while the solver moves on to the next steps.
+  inline void stepInSituView(const int step) {
+    ViewData<SimulationControl>& view_data = this->in_situ_view_.acquire();
+    getRawBinaryBlock(this->mesh_, RawBinaryTypeEnum::Full, view_data.raw_binary_block_);
+    this->solver_.packRawBinary(this->mesh_, false, view_data.raw_binary_);
+    this->in_situ_view_.enqueue(view_data, [this, step, &view_data] {
+      this->view_.stepView(step, this->mesh_, this->physical_model_, view_data);
+    });
+  }
+
+  // NOTE: Compact snapshots are expanded on a solver of their buffer, it is only sized once without the initial
+  // condition, so the buffers rebuild their snapshots at the same time.
+  inline void readViewRawBinary(ViewData<SimulationControl>& view_data) {
+    RawBinaryCompress::readHeader(view_data.raw_binary_path_, view_data.raw_binary_header_,
+                                  view_data.raw_binary_block_);
+    checkRawBinary(view_data.raw_binary_path_, view_data.raw_binary_header_, view_data.raw_binary_block_, this->mesh_,
+                   SimulationControl::kPolynomialOrder);
+    if (view_data.raw_binary_header_.type_ == magic_enum::enum_integer(RawBinaryTypeEnum::Quantized)) {
+      view_data.quantized_raw_binary_block_ = view_data.raw_binary_block_;
+      RawBinaryCompress::read(view_data.raw_binary_path_, view_data.raw_binary_header_,
+                              view_data.quantized_raw_binary_block_, view_data.quantized_raw_binary_);
+      getRawBinaryBlock(this->mesh_, RawBinaryTypeEnum::Full, view_data.raw_binary_block_);
+      dequantizeRawBinary(view_data.quantized_raw_binary_block_, view_data.quantized_raw_binary_,
+                          view_data.raw_binary_block_, view_data.raw_binary_);
+      return;
+    }
+    RawBinaryCompress::read(view_data.raw_binary_path_, view_data.raw_binary_header_, view_data.raw_binary_block_,
+                            view_data.raw_binary_);
+    if (view_data.raw_binary_header_.type_ == magic_enum::enum_integer(RawBinaryTypeEnum::Compact)) {
+      TimeIntegration<SimulationControl> time_integration = this->time_integration_;
+      time_integration.iteration_ = view_data.raw_binary_header_.iteration_;
+      time_integration.delta_time_ = static_cast<Real>(view_data.raw_binary_header_.delta_time_);
+      if (view_data.rebuild_solver_ == nullptr) {
+        view_data.rebuild_solver_ = std::make_unique<Solver<SimulationControl>>();
+        view_data.rebuild_solver_->empirical_tolerance_ = this->solver_.empirical_tolerance_;
+        view_data.rebuild_solver_->artificial_viscosity_factor_ = this->solver_.artificial_viscosity_factor_;
+        view_data.rebuild_solver_->initializeSolver(this->mesh_, this->physical_model_, this->boundary_condition_);
+      }
+      view_data.rebuild_solver_->rebuildRawBinary(this->mesh_, this->physical_model_, this->boundary_condition_,
+                                                  time_integration, view_data.raw_binary_);
+      getRawBinaryBlock(this->mesh_, RawBinaryTypeEnum::Full, view_data.raw_binary_block_);
+    }
+  }
+
+  // NOTE: Steps that the manifest marks as up to date are skipped here, in the follow mode this waits for the raw
+  // binary file of the next step and returns -1 once it does not appear within the timeout.
+  inline Isize getNextViewStep(Isize& step, Isize& view_step_end, tbb::spin_mutex& mtx) {
+    while (true) {
+      while (step <= this->time_integration_.iteration_end_ && step % this->view_.io_interval_ != 0) {
+        step++;
+      }
+      if (step > this->time_integration_.iteration_end_) {
+        return -1;
+      }
+      const std::filesystem::path raw_binary_path =
+          this->view_.output_directory_ / std::format("raw/{}_{}.zst", this->view_.output_file_name_prefix_, step);
+      if (!this->view_.waitRawBinary(raw_binary_path)) {
+        return -1;
+      }
+      view_step_end = step;
+      if (!this->view_.isViewUpToDate(step, this->mesh_.information_, raw_binary_path)) {
+        return step++;
+      }
+      step++;
+      tbb::spin_mutex::scoped_lock lock(mtx);
+      this->command_line_.updateView();
+    }
+  }
+
+  // NOTE: The subset snapshots are viewed one after another once the full snapshots are done, each is expanded into
+  // the layout of a full snapshot and its pieces are spread over the threads. Steps that the manifest of the subset
+  // marks as up to date are skipped, the series stops at the first missing step and the follow mode waits for it first.
+  inline int viewOutputSubset(const Isize subset_index) {
+    const OutputSubset<SimulationControl>& output_subset = this->output_subset_[static_cast<Usize>(subset_index)];
+    ViewData<SimulationControl> view_data;
+    std::vector<char> subset_raw_binary;
+    std::vector<RawBinaryBlock> subset_raw_binary_block;
+    int view_step_end = this->time_integration_.iteration_start_ - 1;
+    for (int i = this->time_integration_.iteration_start_; i <= this->time_integration_.iteration_end_; i++) {
+      if (i % output_subset.io_interval_ != 0) {
+        continue;
+      }
+      const std::filesystem::path raw_binary_path =
+          output_subset.getRawBinaryPath(this->view_.output_directory_, this->view_.output_file_name_prefix_, i);
+      if (!this->view_.waitRawBinary(raw_binary_path) || !std::filesystem::exists(raw_binary_path)) {
+        break;
+      }
+      RawBinaryCompress::readHeader(raw_binary_path, view_data.raw_binary_header_, subset_raw_binary_block);
+      if (i >= this->view_.time_value_number_) {
+        this->view_.time_value_(i) = static_cast<Real>(view_data.raw_binary_header_.time_);
+      }
+      view_step_end = i;
+      if (this->view_.isSubsetViewUpToDate(i, subset_index, raw_binary_path)) {
+        continue;
+      }
+      checkRawBinary(raw_binary_path, view_data.raw_binary_header_, subset_raw_binary_block, this->mesh_,
+                     SimulationControl::kPolynomialOrder);
+      output_subset.checkRawBinary(raw_binary_path, subset_raw_binary_block);
+      RawBinaryCompress::read(raw_binary_path, view_data.raw_binary_header_, subset_raw_binary_block,
+                              subset_raw_binary);
+      output_subset.expandRawBinary(raw_binary_path, this->mesh_, subset_raw_binary, view_data.raw_binary_block_,
+                                    view_data.raw_binary_);
+      this->view_.stepSubsetView(i, subset_index, this->mesh_, this->physical_model_, view_data);
+      this->view_.recordSubsetView(i, subset_index, raw_binary_path);
+    }
+    return view_step_end;
+  }
+
   inline void view(const bool delete_dir = true) {
     this->command_line_.initializeView(
         (this->time_integration_.iteration_end_ - this->time_integration_.iteration_start_) / this->view_.io_interval_ +
         1);
     this->view_.initializeViewFin(delete_dir, this->time_integration_.iteration_end_);
-#ifndef SUBROSA_DG_DEVELOP
-    oneapi::tbb::task_arena arena(kNumberOfPhysicalCores / 2);
-#else   // SUBROSA_DG_DEVELOP
-    oneapi::tbb::task_arena arena(1);
-#endif  // SUBROSA_DG_DEVELOP
+    this->view_.solver_.initialViewSolver(this->mesh_);
+    this->view_.initializeViewIndex(this->mesh_.information_);
+    for (const OutputSubset<SimulationControl>& output_subset : this->output_subset_) {
+      this->view_.addSubsetPhysical(output_subset.physical_, output_subset.element_index_);
+    }
+    Isize snapshot_number = 0;
+    for (Isize i = this->time_integration_.iteration_start_; i <= this->time_integration_.iteration_end_; i++) {
+      if (i % this->view_.io_interval_ == 0) {
+        snapshot_number++;
+      }
+    }
+    this->view_.scheduleView(snapshot_number, this->environment_.view_thread_number_);
+    Isize view_step_end = this->time_integration_.iteration_start_ - 1;
+    oneapi::tbb::task_arena arena(this->environment_.view_thread_number_);
     arena.execute([&] {
       tbb::spin_mutex mtx;
-      tbb::enumerable_thread_specific<ViewData<SimulationControl>> thread_view_data([&] {
-        return ViewData<SimulationControl>(this->mesh_);
-      });
-      tbb::parallel_for(tbb::blocked_range<Isize>(this->time_integration_.iteration_start_,
-                                                  this->time_integration_.iteration_end_ + 1),
-                        [&](const tbb::blocked_range<Isize>& range) {
-                          ViewData<SimulationControl>& view_data = thread_view_data.local();
-                          for (Isize i = range.begin(); i != range.end(); i++) {
-                            if (i % this->view_.io_interval_ == 0) {
-                              view_data.raw_binary_path_ =
-                                  this->view_.output_directory_ /
-                                  std::format("raw/{}_{}.zst", this->view_.output_file_name_prefix_, i);
-                              this->view_.stepView(i, this->mesh_, this->physical_model_, view_data);
-                              {
-                                tbb::spin_mutex::scoped_lock lock(mtx);
-                                this->command_line_.updateView();
-                              }
-                            }
-                          }
-                        });
+      const Usize buffer_number = static_cast<Usize>(
+          this->view_.buffer_number_ > 0 ? this->view_.buffer_number_ : this->environment_.view_thread_number_);
+      std::vector<ViewData<SimulationControl>> view_data(buffer_number);
+      tbb::concurrent_queue<ViewData<SimulationControl>*> free_view_data;
+      for (ViewData<SimulationControl>& buffer_view_data : view_data) {
+        free_view_data.push(&buffer_view_data);
+      }
+      Isize step = this->time_integration_.iteration_start_;
+      // NOTE: The number of live tokens is the number of buffers, so a free buffer is always there when a step starts
+      // and the threads left over help with the pieces and the compression of the steps in flight.
+      tbb::parallel_pipeline(
+          buffer_number,
+          tbb::make_filter<void, Isize>(tbb::filter_mode::serial_in_order,
+                                        [&](tbb::flow_control& flow_control) -> Isize {
+                                          const Isize view_step = this->getNextViewStep(step, view_step_end, mtx);
+                                          if (view_step < 0) {
+                                            flow_control.stop();
+                                            return 0;
+                                          }
+                                          return view_step;
+                                        }) &
+              tbb::make_filter<Isize, void>(tbb::filter_mode::parallel, [&](const Isize i) {
+                ViewData<SimulationControl>* step_view_data = nullptr;
+                if (!free_view_data.try_pop(step_view_data)) [[unlikely]] {
+                  throw std::runtime_error(std::format("No free view buffer is left for step {}.", i));
+                }
+                step_view_data->raw_binary_path_ =
+                    this->view_.output_directory_ /
+                    std::format("raw/{}_{}.zst", this->view_.output_file_name_prefix_, i);
+                this->readViewRawBinary(*step_view_data);
+                if (i >= this->view_.time_value_number_) {
+                  this->view_.time_value_(i) = static_cast<Real>(step_view_data->raw_binary_header_.time_);
+                }
+                this->view_.stepView(i, this->mesh_, this->physical_model_, *step_view_data);
+                this->view_.recordView(i, step_view_data->raw_binary_path_);
+                free_view_data.push(step_view_data);
+                {
+                  tbb::spin_mutex::scoped_lock lock(mtx);
+                  this->command_line_.updateView();
+                }
+              }));
+      this->view_.scheduleView(1, this->environment_.view_thread_number_);
+      for (Isize i = 0; i < static_cast<Isize>(this->output_subset_.size()); i++) {
+        this->view_.writeSubsetViewCollection(this->mesh_.information_, i,
+                                              this->output_subset_[static_cast<Usize>(i)].io_interval_,
+                                              this->time_integration_.iteration_start_,
+                                              this->viewOutputSubset(i));
+      }
     });
+    this->view_.writeViewCollection(this->mesh_.information_, this->time_integration_.iteration_start_,
+                                    view_step_end);
     this->view_.finalizeViewFin();
   }
 
   explicit inline System() : command_line_(true) {}
 
   explicit inline System(const bool open_command_line) : command_line_(open_command_line) {}
+
+  inline System(const int argc, char* argv[]) : environment_(argc, argv), command_line_(true) {}
+
+  inline System(const bool open_command_line, const int argc, char* argv[])
+      : environment_(argc, argv), command_line_(open_command_line) {}
 };
 
 }  // namespace SubrosaDG
@@ -32,6 +32,7 @@
 #include "Utils/BasicDataType.cpp"
 #include "Utils/Constant.cpp"
 #include "Utils/Enum.cpp"
+#include "Utils/Environment.cpp"
 
 namespace SubrosaDG {
 
@@ -162,7 +163,7 @@ struct CommandLine {
     }
   }
 
-  inline void printInformation() {
+  inline void printInformation(const Environment& environment) {
     if (this->is_open_) {
       std::stringstream information;
       information << "\n";
@@ -186,6 +187,9 @@ struct CommandLine {
 #ifndef SUBROSA_DG_GPU
       information << std::format("CPU Device: {}", kDevice.get_info<sycl::info::device::name>()) << '\n';
       information << std::format("Number of physical cores: {}", kNumberOfPhysicalCores) << "\n";
+      information << std::format("Number of threads: {}, view threads: {}", environment.thread_number_,
+                                 environment.view_thread_number_)
+                  << "\n";
       information << std::format("Eigen SIMD Instructions: {}", Eigen::SimdInstructionSetsInUse()) << "\n";
 #else   // SUBROSA_DG_GPU
       information << std::format("GPU Device: {}", kDevice.get_info<sycl::info::device::name>()) << '\n';
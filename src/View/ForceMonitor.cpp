@@ -0,0 +1,355 @@
+/**
+ * @file ForceMonitor.cpp
+ * @brief The header file of SubrosaDG boundary force monitor.
+ *
+ * @author Yufei.Liu, Calm.Liu@outlook.com | Chenyu.Bao, bcynuaa@163.com
+ * @date 2025-04-15
+ *
+ * @version 0.1.0
+ * @copyright Copyright (c) 2022 - 2025 by SubrosaDG developers. All rights reserved.
+ * SubrosaDG is free software and is distributed under the MIT license.
+ */
+
+#ifndef SUBROSA_DG_FORCE_MONITOR_CPP_
+#define SUBROSA_DG_FORCE_MONITOR_CPP_
+
+#include <oneapi/tbb.h>
+
+#include <Eigen/Core>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <ios>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Mesh/ReadControl.cpp"
+#include "Solver/PhysicalModel.cpp"
+#include "Solver/SimulationControl.cpp"
+#include "Solver/SolveControl.cpp"
+#include "Solver/VariableConvertor.cpp"
+#include "Utils/BasicDataType.cpp"
+#include "Utils/Concept.cpp"
+#include "Utils/Enum.cpp"
+#include "Utils/ParallelControl.cpp"
+
+namespace SubrosaDG {
+
+inline constexpr std::array<char, 8> kForceMonitorMagic{'S', 'D', 'G', 'F', 'O', 'R', 'C', 'E'};
+inline constexpr std::array<char, 8> kSurfaceDistributionMagic{'S', 'D', 'G', 'S', 'U', 'R', 'F', 'C'};
+inline constexpr std::uint32_t kForceMonitorVersion{1};
+
+template <int Dimension>
+inline consteval int getMomentNumber() {
+  if constexpr (Dimension == 2) {
+    return 1;
+  } else if constexpr (Dimension == 3) {
+    return 3;
+  }
+  return 0;
+}
+
+struct ForceMonitorFace {
+  int gmsh_type_;
+  Isize element_index_;
+  Isize group_index_;
+  Isize node_offset_;
+};
+
+// NOTE: The force history file starts with the magic, the version, the dimension, the group number, the value number of
+// each group, the physical index of each group and the reference values (density, velocity, pressure, area, length and
+// moment center). Every record then holds the step, the time value and the force and moment coefficients of each group.
+// A surface distribution file holds the step, the time value and, for each boundary quadrature node, the coordinate,
+// the physical index, the pressure coefficient and the skin friction coefficient vector. All values are written as
+// little endian doubles.
+template <typename SimulationControl>
+struct ForceMonitor {
+  inline static constexpr int kMomentNumber{getMomentNumber<SimulationControl::kDimension>()};
+  inline static constexpr int kValueNumber{SimulationControl::kDimension + kMomentNumber};
+  inline static constexpr int kSurfaceValueNumber{2 * SimulationControl::kDimension + 2};
+
+  bool is_open_{false};
+  int interval_{1};
+  int distribution_interval_{0};
+  std::vector<Isize> physical_index_;
+  Real reference_density_{1.0_r};
+  Real reference_velocity_{1.0_r};
+  Real reference_pressure_{0.0_r};
+  Real reference_area_{1.0_r};
+  Real reference_length_{1.0_r};
+  Eigen::Vector<Real, SimulationControl::kDimension> moment_center_{
+      Eigen::Vector<Real, SimulationControl::kDimension>::Zero()};
+  std::filesystem::path distribution_directory_;
+  std::string distribution_file_name_prefix_;
+  std::vector<ForceMonitorFace> face_;
+  Isize node_number_{0};
+  Eigen::Matrix<Real, kValueNumber, Eigen::Dynamic> face_value_;
+  std::vector<double> surface_value_;
+  std::fstream force_fout_;
+  std::vector<double> record_;
+
+  [[nodiscard]] inline Real getDynamicPressure() const {
+    return 0.5_r * this->reference_density_ * this->reference_velocity_ * this->reference_velocity_;
+  }
+
+  template <typename AdjacencyElementTrait>
+  inline void addAdjacencyElementFace(const AdjacencyElementMesh<AdjacencyElementTrait>& adjacency_element_mesh) {
+    for (Isize i = adjacency_element_mesh.interior_number_;
+         i < adjacency_element_mesh.interior_number_ + adjacency_element_mesh.boundary_number_; i++) {
+      for (std::size_t j = 0; j < this->physical_index_.size(); j++) {
+        if (adjacency_element_mesh.element_(i).gmsh_physical_index_ == this->physical_index_[j]) {
+          this->face_.emplace_back(ForceMonitorFace{.gmsh_type_ = AdjacencyElementTrait::kGmshTypeNumber,
+                                                    .element_index_ = i,
+                                                    .group_index_ = static_cast<Isize>(j),
+                                                    .node_offset_ = this->node_number_});
+          this->node_number_ += AdjacencyElementTrait::kQuadratureNumber;
+          break;
+        }
+      }
+    }
+  }
+
+  [[nodiscard]] inline std::vector<char> getForceHeader() const {
+    std::vector<std::uint32_t> header{kForceMonitorVersion, static_cast<std::uint32_t>(SimulationControl::kDimension),
+                                      static_cast<std::uint32_t>(this->physical_index_.size()),
+                                      static_cast<std::uint32_t>(kValueNumber)};
+    for (const Isize physical_index : this->physical_index_) {
+      header.emplace_back(static_cast<std::uint32_t>(physical_index));
+    }
+    std::vector<double> reference{static_cast<double>(this->reference_density_),
+                                  static_cast<double>(this->reference_velocity_),
+                                  static_cast<double>(this->reference_pressure_),
+                                  static_cast<double>(this->reference_area_),
+                                  static_cast<double>(this->reference_length_)};
+    for (Isize i = 0; i < SimulationControl::kDimension; i++) {
+      reference.emplace_back(static_cast<double>(this->moment_center_(i)));
+    }
+    std::vector<char> force_header{kForceMonitorMagic.begin(), kForceMonitorMagic.end()};
+    force_header.insert(force_header.end(), reinterpret_cast<const char*>(header.data()),
+                        reinterpret_cast<const char*>(header.data() + header.size()));
+    force_header.insert(force_header.end(), reinterpret_cast<const char*>(reference.data()),
+                        reinterpret_cast<const char*>(reference.data() + reference.size()));
+    return force_header;
+  }
+
+  // NOTE: A restart continues the history after its restart step, so the records an earlier run wrote after that step
+  // and a partial record of an interrupted write are cut off before appending. A history of other groups or reference
+  // values can not be continued and is written anew.
+  [[nodiscard]] inline bool truncateForceHistory(const std::filesystem::path& force_file_path,
+                                                 const std::vector<char>& force_header,
+                                                 const int iteration_start) const {
+    const std::uintmax_t header_size = force_header.size();
+    const std::uintmax_t file_size = std::filesystem::file_size(force_file_path);
+    if (file_size < header_size) {
+      return false;
+    }
+    std::ifstream fin(force_file_path, std::ios::in | std::ios::binary);
+    std::vector<char> file_header(force_header.size());
+    fin.read(file_header.data(), static_cast<std::streamsize>(file_header.size()));
+    if (!fin || file_header != force_header) {
+      return false;
+    }
+    const std::uintmax_t record_size = this->record_.size() * sizeof(double);
+    std::uintmax_t record_number = (file_size - header_size) / record_size;
+    for (std::uintmax_t i = 0; i < record_number; i++) {
+      double step;
+      fin.seekg(static_cast<std::streamoff>(header_size + i * record_size));
+      fin.read(reinterpret_cast<char*>(&step), sizeof(double));
+      if (!fin || step > static_cast<double>(iteration_start)) {
+        record_number = i;
+        break;
+      }
+    }
+    fin.close();
+    std::filesystem::resize_file(force_file_path, header_size + record_number * record_size);
+    return true;
+  }
+
+  inline void initializeForceMonitor(const Mesh<SimulationControl>& mesh, const std::filesystem::path& force_file_path,
+                                     const std::filesystem::path& distribution_directory,
+                                     const std::string& distribution_file_name_prefix, const int iteration_start,
+                                     const bool is_append) {
+    for (const Isize physical_index : this->physical_index_) {
+      if (physical_index < 1 || physical_index > mesh.information_.physical_number_ ||
+          mesh.information_.physical_[static_cast<Usize>(physical_index) - 1].dimension_ !=
+              SimulationControl::kDimension - 1) [[unlikely]] {
+        throw std::runtime_error(std::format("Physical group {} is not a boundary of the mesh.", physical_index));
+      }
+    }
+    this->face_.clear();
+    this->node_number_ = 0;
+    if constexpr (SimulationControl::kDimension == 1) {
+      this->addAdjacencyElementFace(mesh.point_);
+    } else if constexpr (SimulationControl::kDimension == 2) {
+      this->addAdjacencyElementFace(mesh.line_);
+    } else if constexpr (SimulationControl::kDimension == 3) {
+      if constexpr (HasAdjacencyTriangle<SimulationControl::kMeshModel>) {
+        this->addAdjacencyElementFace(mesh.triangle_);
+      }
+      if constexpr (HasAdjacencyQuadrangle<SimulationControl::kMeshModel>) {
+        this->addAdjacencyElementFace(mesh.quadrangle_);
+      }
+    }
+    this->face_value_.resize(Eigen::NoChange, static_cast<Isize>(this->face_.size()));
+    if (this->distribution_interval_ > 0) {
+      this->surface_value_.resize(static_cast<std::size_t>(2 + this->node_number_ * kSurfaceValueNumber));
+      this->distribution_directory_ = distribution_directory;
+      this->distribution_file_name_prefix_ = distribution_file_name_prefix;
+      std::filesystem::create_directories(distribution_directory);
+    }
+    this->record_.resize(2 + this->physical_index_.size() * static_cast<std::size_t>(kValueNumber));
+    std::filesystem::create_directories(force_file_path.parent_path());
+    const std::vector<char> force_header{this->getForceHeader()};
+    const bool is_header_needed = !is_append || !std::filesystem::exists(force_file_path) ||
+                                  !this->truncateForceHistory(force_file_path, force_header, iteration_start);
+    this->force_fout_.open(force_file_path,
+                           std::ios::out | std::ios::binary | (is_header_needed ? std::ios::trunc : std::ios::app));
+    if (is_header_needed) {
+      this->force_fout_.write(force_header.data(), static_cast<std::streamsize>(force_header.size()));
+    }
+    this->is_open_ = true;
+  }
+
+  // NOTE: The traction on the wall is (p - p_ref) n - tau n with the normal vector pointing out of the fluid, the same
+  // sign as the force of the view. The left state and the lifted gradient of the parent element are used at the wall.
+  template <typename AdjacencyElementTrait>
+  inline void calculateAdjacencyElementForce(const Mesh<SimulationControl>& mesh,
+                                             const PhysicalModel<SimulationControl>& physical_model,
+                                             const Solver<SimulationControl>& solver, const Isize face_index,
+                                             const bool is_distribution) {
+    const ForceMonitorFace& face = this->face_[static_cast<Usize>(face_index)];
+    const AdjacencyElementMesh<AdjacencyElementTrait>& adjacency_element_mesh =
+        mesh.*(Mesh<SimulationControl>::template getAdjacencyElement<AdjacencyElementTrait>());
+    const PerAdjacencyElementMesh<AdjacencyElementTrait>& element =
+        adjacency_element_mesh.element_(face.element_index_);
+    AdjacencyElementVariable<AdjacencyElementTrait, SimulationControl> variable;
+    variable.get(mesh, solver, element.parent_gmsh_type_number_(0), element.parent_index_each_type_(0),
+                 element.adjacency_sequence_in_parent_(0));
+    variable.calculateComputationalFromConserved(physical_model);
+    [[maybe_unused]] AdjacencyElementVariableGradient<AdjacencyElementTrait, SimulationControl> variable_gradient;
+    if constexpr (IsNS<SimulationControl::kEquationModel>) {
+      variable_gradient.template get<SimulationControl::kViscousFlux>(
+          mesh, solver, element.parent_gmsh_type_number_(0), element.parent_index_each_type_(0),
+          element.adjacency_sequence_in_parent_(0));
+      variable_gradient.calculatePrimitiveFromConserved(physical_model, variable);
+    }
+    const Real dynamic_pressure = this->getDynamicPressure();
+    Eigen::Vector<Real, kValueNumber> value{Eigen::Vector<Real, kValueNumber>::Zero()};
+    for (Isize i = 0; i < AdjacencyElementTrait::kQuadratureNumber; i++) {
+      const Eigen::Vector<Real, SimulationControl::kDimension> normal_vector = element.normal_vector_.col(i);
+      const Real pressure =
+          variable.template getScalar<ComputationalVariableEnum::Pressure>(i) - this->reference_pressure_;
+      Eigen::Vector<Real, SimulationControl::kDimension> wall_shear_stress{
+          Eigen::Vector<Real, SimulationControl::kDimension>::Zero()};
+      if constexpr (IsNS<SimulationControl::kEquationModel>) {
+        const Eigen::Matrix<Real, SimulationControl::kDimension, SimulationControl::kDimension> velocity_gradient =
+            variable_gradient.template getMatrix<PrimitiveVariableEnum::Velocity>(i);
+        const Real tempurature = physical_model.calculateTemperatureFromInternalEnergy(
+            variable.template getScalar<ComputationalVariableEnum::InternalEnergy>(i));
+        const Real dynamic_viscosity = physical_model.calculateDynamicViscosity(tempurature);
+        wall_shear_stress.noalias() = -calculateViscousStress(dynamic_viscosity, velocity_gradient) * normal_vector;
+      }
+      const Eigen::Vector<Real, SimulationControl::kDimension> traction = pressure * normal_vector + wall_shear_stress;
+      const Eigen::Vector<Real, SimulationControl::kDimension> arm =
+          element.quadrature_node_coordinate_.col(i) - this->moment_center_;
+      const Real weight = element.jacobian_determinant_mutiply_weight_(i);
+      value.template head<SimulationControl::kDimension>() += traction * weight;
+      if constexpr (SimulationControl::kDimension == 2) {
+        value(2) += (arm(0) * traction(1) - arm(1) * traction(0)) * weight;
+      } else if constexpr (SimulationControl::kDimension == 3) {
+        value.template tail<3>() += arm.cross(traction) * weight;
+      }
+      if (is_distribution) {
+        double* surface_value = this->surface_value_.data() + 2 +
+                                static_cast<std::size_t>((face.node_offset_ + i) * kSurfaceValueNumber);
+        wall_shear_stress -= normal_vector.dot(wall_shear_stress) * normal_vector;
+        for (Isize j = 0; j < SimulationControl::kDimension; j++) {
+          surface_value[j] = static_cast<double>(element.quadrature_node_coordinate_(j, i));
+          surface_value[SimulationControl::kDimension + 2 + j] =
+              static_cast<double>(wall_shear_stress(j) / dynamic_pressure);
+        }
+        surface_value[SimulationControl::kDimension] = static_cast<double>(element.gmsh_physical_index_);
+        surface_value[SimulationControl::kDimension + 1] = static_cast<double>(pressure / dynamic_pressure);
+      }
+    }
+    this->face_value_.col(face_index) = value;
+  }
+
+  inline void writeForceMonitor(const int step, const Real time_value, const Mesh<SimulationControl>& mesh,
+                                const PhysicalModel<SimulationControl>& physical_model,
+                                const Solver<SimulationControl>& solver) {
+    const bool is_distribution = this->distribution_interval_ > 0 && step % this->distribution_interval_ == 0;
+    parallelFor(0, static_cast<Isize>(this->face_.size()), [&](const tbb::blocked_range<Isize>& range) {
+      for (Isize i = range.begin(); i != range.end(); i++) {
+        [[maybe_unused]] const int gmsh_type = this->face_[static_cast<Usize>(i)].gmsh_type_;
+        if constexpr (SimulationControl::kDimension == 1) {
+          this->calculateAdjacencyElementForce<AdjacencyPointTrait<SimulationControl::kPolynomialOrder>>(
+              mesh, physical_model, solver, i, is_distribution);
+        } else if constexpr (SimulationControl::kDimension == 2) {
+          this->calculateAdjacencyElementForce<AdjacencyLineTrait<SimulationControl::kPolynomialOrder>>(
+              mesh, physical_model, solver, i, is_distribution);
+        } else if constexpr (SimulationControl::kDimension == 3) {
+          if (gmsh_type == AdjacencyTriangleTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+            this->calculateAdjacencyElementForce<AdjacencyTriangleTrait<SimulationControl::kPolynomialOrder>>(
+                mesh, physical_model, solver, i, is_distribution);
+          } else if (gmsh_type == AdjacencyQuadrangleTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+            this->calculateAdjacencyElementForce<AdjacencyQuadrangleTrait<SimulationControl::kPolynomialOrder>>(
+                mesh, physical_model, solver, i, is_distribution);
+          }
+        }
+      }
+    });
+    // NOTE: The faces are summed in a fixed order, so the history does not depend on the thread number.
+    Eigen::Matrix<Real, kValueNumber, Eigen::Dynamic> group_value =
+        Eigen::Matrix<Real, kValueNumber, Eigen::Dynamic>::Zero(kValueNumber,
+                                                                static_cast<Isize>(this->physical_index_.size()));
+    for (std::size_t i = 0; i < this->face_.size(); i++) {
+      group_value.col(this->face_[i].group_index_) += this->face_value_.col(static_cast<Isize>(i));
+    }
+    const Real force_scale = this->getDynamicPressure() * this->reference_area_;
+    group_value.template topRows<SimulationControl::kDimension>() /= force_scale;
+    group_value.template bottomRows<kMomentNumber>() /= force_scale * this->reference_length_;
+    this->record_[0] = static_cast<double>(step);
+    this->record_[1] = static_cast<double>(time_value);
+    for (Isize i = 0; i < group_value.size(); i++) {
+      this->record_[2 + static_cast<std::size_t>(i)] = static_cast<double>(group_value.data()[i]);
+    }
+    this->force_fout_.write(reinterpret_cast<const char*>(this->record_.data()),
+                            static_cast<std::streamsize>(this->record_.size() * sizeof(double)));
+    if (is_distribution) {
+      this->writeSurfaceDistribution(step, time_value);
+    }
+  }
+
+  inline void writeSurfaceDistribution(const int step, const Real time_value) {
+    this->surface_value_[0] = static_cast<double>(step);
+    this->surface_value_[1] = static_cast<double>(time_value);
+    const std::array<std::uint32_t, 3> header{kForceMonitorVersion,
+                                              static_cast<std::uint32_t>(SimulationControl::kDimension),
+                                              static_cast<std::uint32_t>(this->node_number_)};
+    std::ofstream fout(this->distribution_directory_ /
+                           std::format("{}_surface_{}.bin", this->distribution_file_name_prefix_, step),
+                       std::ios::out | std::ios::binary | std::ios::trunc);
+    fout.write(kSurfaceDistributionMagic.data(), static_cast<std::streamsize>(kSurfaceDistributionMagic.size()));
+    fout.write(reinterpret_cast<const char*>(header.data()),
+               static_cast<std::streamsize>(header.size() * sizeof(std::uint32_t)));
+    fout.write(reinterpret_cast<const char*>(this->surface_value_.data()),
+               static_cast<std::streamsize>(this->surface_value_.size() * sizeof(double)));
+    fout.close();
+  }
+
+  inline void finalizeForceMonitor() {
+    if (this->force_fout_.is_open()) {
+      this->force_fout_.close();
+    }
+    this->is_open_ = false;
+  }
+};
+
+}  // namespace SubrosaDG
+
+#endif  // SUBROSA_DG_FORCE_MONITOR_CPP_
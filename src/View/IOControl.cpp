@@ -13,12 +13,27 @@
 #ifndef SUBROSA_DG_IO_CONTROL_CPP_
 #define SUBROSA_DG_IO_CONTROL_CPP_
 
+#include <oneapi/tbb.h>
+
 #include <Eigen/Core>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
 #include <filesystem>
+#include <format>
 #include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 #include <vtu11-cpp17.hpp>
 
@@ -26,9 +41,13 @@
 #include "Mesh/ReadControl.cpp"
 #include "Solver/PhysicalModel.cpp"
 #include "Solver/SimulationControl.cpp"
+#include "Solver/SolveControl.cpp"
 #include "Solver/VariableConvertor.cpp"
 #include "Utils/BasicDataType.cpp"
 #include "Utils/Enum.cpp"
+#include "View/RawBinaryCompress.cpp"
+#include "View/VtuWriter.cpp"
+#include "View/XdmfWriter.cpp"
 
 namespace SubrosaDG {
 
@@ -96,29 +115,38 @@ struct ElementViewBasisFunction {
 template <typename ElementTrait, typename SimulationControl>
 struct ElementViewSolver {
   ElementViewBasisFunction<ElementTrait> basis_function_;
-  Eigen::Array<ViewVariable<ElementTrait, SimulationControl>, Eigen::Dynamic, 1> view_variable_;
+  std::size_t raw_binary_offset_{0};
+
+  inline void calcluateElementViewVariable(
+      const ElementMesh<ElementTrait>& element_mesh, const PhysicalModel<SimulationControl>& physical_model,
+      const Eigen::Map<const Eigen::Vector<Real, Eigen::Dynamic>>& node_artificial_viscosity,
+      const std::vector<char>& raw_binary, Isize element_index,
+      ViewVariable<ElementTrait, SimulationControl>& view_variable) const;
 
-  inline void calcluateElementViewVariable(const ElementMesh<ElementTrait>& element_mesh,
-                                           const PhysicalModel<SimulationControl>& physical_model,
-                                           const Eigen::Vector<Real, Eigen::Dynamic>& node_artificial_viscosity,
-                                           std::stringstream& raw_binary_ss);
+  inline void initialElementViewSolver(const ElementMesh<ElementTrait>& element_mesh, std::size_t& raw_binary_offset);
 };
 
 template <typename AdjacencyElementTrait, typename SimulationControl>
 struct AdjacencyElementViewSolver {
   AdjacencyElementViewBasisFunction<AdjacencyElementTrait> basis_function_;
-  Eigen::Array<ViewVariable<AdjacencyElementTrait, SimulationControl>, Eigen::Dynamic, 1> view_variable_;
+  std::vector<std::size_t> raw_binary_offset_;
 
   template <typename ElementTrait>
   inline void calcluateAdjacencyPerElementViewVariable(
       const PhysicalModel<SimulationControl>& physical_model,
-      const ElementViewSolver<ElementTrait, SimulationControl>& element_view_solver, std::stringstream& raw_binary_ss,
-      Isize adjacency_sequence_in_parent, Isize parent_gmsh_type_number, Isize column);
+      const ElementViewSolver<ElementTrait, SimulationControl>& element_view_solver, const char* raw_binary,
+      Isize adjacency_sequence_in_parent, Isize parent_gmsh_type_number,
+      ViewVariable<AdjacencyElementTrait, SimulationControl>& view_variable) const;
 
   inline void calcluateAdjacencyElementViewVariable(
       const AdjacencyElementMesh<AdjacencyElementTrait>& adjacency_element_mesh,
       const PhysicalModel<SimulationControl>& physical_model, const ViewSolver<SimulationControl>& view_solver,
-      const Eigen::Vector<Real, Eigen::Dynamic>& node_artificial_viscosity, std::stringstream& raw_binary_ss);
+      const Eigen::Map<const Eigen::Vector<Real, Eigen::Dynamic>>& node_artificial_viscosity,
+      const std::vector<char>& raw_binary, Isize element_index,
+      ViewVariable<AdjacencyElementTrait, SimulationControl>& view_variable) const;
+
+  inline void initialAdjacencyElementViewSolver(
+      const AdjacencyElementMesh<AdjacencyElementTrait>& adjacency_element_mesh, std::size_t& raw_binary_offset);
 };
 
 template <typename SimulationControl, int Dimension>
@@ -197,35 +225,29 @@ struct ViewSolver : ViewSolverData<SimulationControl, SimulationControl::kDimens
     }
   }
 
-  inline void calcluateViewVariable(const Mesh<SimulationControl>& mesh,
-                                    const PhysicalModel<SimulationControl>& physical_model,
-                                    const std::filesystem::path& raw_binary_path, std::stringstream& raw_binary_ss);
-
   inline void initialViewSolver(const Mesh<SimulationControl>& mesh);
 
   inline void initialViewSolver(const ViewSolver<SimulationControl>& view_solver);
 
   inline void updateRawBinaryVersion(const Mesh<SimulationControl>& mesh, const std::filesystem::path& raw_binary_path,
-                                     std::stringstream& raw_binary_ss);
+                                     std::vector<char>& raw_binary);
 };
 
+// NOTE: The write position of one element range, ranges of the same physical group start from the prefix sum of the
+// sizes of the ranges before them and are written concurrently.
 template <typename SimulationControl>
-struct ViewData {
-  std::filesystem::path raw_binary_path_;
-  std::stringstream raw_binary_ss_;
-  ViewSolver<SimulationControl> solver_;
-
-  ViewData(const Mesh<SimulationControl>& mesh) { this->solver_.initialViewSolver(mesh); }
-
-  // ViewData(const ViewData<SimulationControl>& view_data) { this->solver_.initialViewSolver(view_data.solver_); }
+struct ViewIndex {
+  Isize node_index_{0};
+  Isize vtk_node_index_{0};
+  Isize vtk_element_index_{0};
+  Eigen::Vector<Real, SimulationControl::kDimension> force_{Eigen::Vector<Real, SimulationControl::kDimension>::Zero()};
 };
 
 template <typename SimulationControl>
 struct ViewSupplemental {
-  Isize node_index_{0};
-  Isize vtk_node_index_{0};
-  Isize vtk_element_index_{0};
-  std::vector<vtu11::DataSetInfo> data_set_information_;
+  Isize element_begin_{-1};
+  Isize element_end_{-1};
+  bool is_geometry_valid_{false};
   std::vector<vtu11::DataSetData> data_set_data_;
   Eigen::Matrix<Real, 3, Eigen::Dynamic> node_coordinate_;
   Eigen::Array<Eigen::Vector<Real, Eigen::Dynamic>, Eigen::Dynamic, 1> node_variable_;
@@ -234,15 +256,26 @@ struct ViewSupplemental {
   Eigen::Vector<vtu11::VtkCellType, Eigen::Dynamic> element_type_;
   Eigen::Vector<Real, SimulationControl::kDimension> force_{Eigen::Vector<Real, SimulationControl::kDimension>::Zero()};
 
-  ViewSupplemental(Isize physical_index, const Mesh<SimulationControl>& mesh,
-                   const std::vector<ViewVariableEnum>& variable_type) {
+  // NOTE: Each buffer always holds the same physical group, so the coordinates and the connectivity written for the
+  // same element range in an earlier snapshot are still valid and only the node variables are written again.
+  inline void resize(const Isize element_begin, const Isize element_end, const Isize node_number,
+                     const Isize vtk_node_number, const Isize vtk_element_number,
+                     const std::vector<ViewVariableEnum>& variable_type) {
+    this->is_geometry_valid_ = this->element_begin_ == element_begin && this->element_end_ == element_end;
+    this->element_begin_ = element_begin;
+    this->element_end_ = element_end;
+    this->force_.setZero();
     this->data_set_data_.resize(variable_type.size() + 3);
-    const Isize node_number = mesh.information_.physical_[static_cast<Usize>(physical_index)].node_number_;
-    const Isize vtk_node_number = mesh.information_.physical_[static_cast<Usize>(physical_index)].vtk_node_number_;
-    const Isize vtk_element_number =
-        mesh.information_.physical_[static_cast<Usize>(physical_index)].vtk_element_number_;
-    this->node_coordinate_.resize(Eigen::NoChange, node_number);
-    this->node_coordinate_.setZero();
+    for (vtu11::DataSetData& data_set_data : this->data_set_data_) {
+      data_set_data.clear();
+    }
+    if (!this->is_geometry_valid_) {
+      this->node_coordinate_.resize(Eigen::NoChange, node_number);
+      this->node_coordinate_.setZero();
+      this->element_connectivity_.resize(vtk_node_number);
+      this->element_offset_.resize(vtk_element_number);
+      this->element_type_.resize(vtk_element_number);
+    }
     this->node_variable_.resize(static_cast<Isize>(variable_type.size()));
     for (Isize i = 0; const auto variable : variable_type) {
       if ((SimulationControl::kDimension >= 2) &&
@@ -254,31 +287,220 @@ struct ViewSupplemental {
         this->node_variable_(i++).resize(node_number);
       }
     }
-    this->element_connectivity_.resize(vtk_node_number);
-    this->element_offset_.resize(vtk_element_number);
-    this->element_type_.resize(vtk_element_number);
   }
 };
 
+// NOTE: A snapshot only owns its raw binary, the output buffers of each physical group and the solver that rebuilds
+// its compact snapshots, the basis functions and the offsets live in the solver of the view and are shared by all
+// snapshots.
+template <typename SimulationControl>
+struct ViewData {
+  std::filesystem::path raw_binary_path_;
+  RawBinaryHeader raw_binary_header_;
+  std::vector<RawBinaryBlock> raw_binary_block_;
+  std::vector<RawBinaryBlock> quantized_raw_binary_block_;
+  std::vector<char> raw_binary_;
+  std::vector<char> quantized_raw_binary_;
+  std::vector<std::vector<ViewSupplemental<SimulationControl>>> view_supplemental_;
+  std::unique_ptr<Solver<SimulationControl>> rebuild_solver_;
+};
+
+// NOTE: The view runs on its own arena without a slot for the solver thread, at most capacity snapshots are held in
+// memory and acquire blocks the solver until one of them is written.
+template <typename SimulationControl>
+struct InSituView {
+  bool is_open_{false};
+  int thread_number_{1};
+  Usize capacity_{1};
+
+  std::unique_ptr<oneapi::tbb::task_arena> arena_;
+  std::deque<ViewData<SimulationControl>> view_data_;
+  std::vector<ViewData<SimulationControl>*> free_view_data_;
+  std::exception_ptr exception_;
+  std::mutex mutex_;
+  std::condition_variable condition_variable_;
+
+  // NOTE: An error of a view task is thrown on the solver thread by the next acquire or wait.
+  inline void rethrowException() {
+    if (this->exception_) [[unlikely]] {
+      std::rethrow_exception(std::exchange(this->exception_, nullptr));
+    }
+  }
+
+  inline ViewData<SimulationControl>& acquire() {
+    std::unique_lock<std::mutex> lock(this->mutex_);
+    this->rethrowException();
+    if (!this->arena_) {
+      this->arena_ = std::make_unique<oneapi::tbb::task_arena>(this->thread_number_, 0);
+    }
+    if (this->free_view_data_.empty() && this->view_data_.size() < this->capacity_) {
+      return this->view_data_.emplace_back();
+    }
+    this->condition_variable_.wait(lock, [this] { return !this->free_view_data_.empty(); });
+    ViewData<SimulationControl>* view_data = this->free_view_data_.back();
+    this->free_view_data_.pop_back();
+    return *view_data;
+  }
+
+  inline void enqueue(ViewData<SimulationControl>& view_data, std::function<void()> function) {
+    this->arena_->enqueue([this, &view_data, function = std::move(function)] {
+      std::exception_ptr exception;
+      try {
+        function();
+      } catch (...) {
+        exception = std::current_exception();
+      }
+      std::lock_guard<std::mutex> lock(this->mutex_);
+      if (exception && !this->exception_) {
+        this->exception_ = exception;
+      }
+      this->free_view_data_.emplace_back(&view_data);
+      this->condition_variable_.notify_all();
+    });
+  }
+
+  inline void wait() {
+    std::unique_lock<std::mutex> lock(this->mutex_);
+    this->condition_variable_.wait(lock, [this] { return this->free_view_data_.size() == this->view_data_.size(); });
+    this->rethrowException();
+  }
+};
+
+inline constexpr int kViewElementChunkFactor{4};
+
+inline std::int64_t getRawBinaryTime(const std::filesystem::path& raw_binary_path) {
+  return static_cast<std::int64_t>(std::filesystem::last_write_time(raw_binary_path).time_since_epoch().count());
+}
+
+// NOTE: The manifest starts with the view settings it was written with and then records the raw binary time of every
+// converted step, one line per step. A line is appended as soon as the step is written, so an interrupted view keeps
+// everything it finished and a partial last line only makes that step stale.
+struct ViewManifest {
+  std::unordered_map<int, std::int64_t> raw_binary_time_;
+  std::fstream manifest_fout_;
+  std::mutex mutex_;
+
+  inline void open(const std::filesystem::path& manifest_path, const std::string& signature) {
+    this->raw_binary_time_.clear();
+    std::fstream manifest_fin(manifest_path, std::ios::in);
+    std::string line;
+    const bool is_signature_matched = manifest_fin.is_open() && std::getline(manifest_fin, line) && line == signature;
+    if (is_signature_matched) {
+      int step;
+      std::int64_t raw_binary_time;
+      while (manifest_fin >> step >> raw_binary_time) {
+        this->raw_binary_time_[step] = raw_binary_time;
+      }
+    }
+    manifest_fin.close();
+    this->manifest_fout_.open(manifest_path, std::ios::out | (is_signature_matched ? std::ios::app : std::ios::trunc));
+    if (!is_signature_matched) {
+      this->manifest_fout_ << signature << '\n' << std::flush;
+    }
+  }
+
+  inline bool isUpToDate(const int step, const std::int64_t raw_binary_time) const {
+    const auto iter = this->raw_binary_time_.find(step);
+    return iter != this->raw_binary_time_.end() && iter->second == raw_binary_time;
+  }
+
+  inline void record(const int step, const std::int64_t raw_binary_time) {
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    this->manifest_fout_ << step << ' ' << raw_binary_time << '\n' << std::flush;
+  }
+
+  inline void close() {
+    if (this->manifest_fout_.is_open()) {
+      this->manifest_fout_.close();
+    }
+  }
+};
+
+// NOTE: One output row of the node variable arrays, vector variables are split into one component per row and the
+// third component of a 2d vector is only filled with zeros.
+struct ViewVariableComponent {
+  Isize variable_index_;
+  Isize stride_;
+  Isize offset_;
+  ViewVariableEnum variable_type_;
+  bool is_zero_{false};
+};
+
 template <typename SimulationControl>
 struct View {
   int io_interval_;
+  int checkpoint_interval_{-1};
+  int partition_number_{1};
+  int buffer_number_{0};
+  int element_chunk_number_{1};
+  ViewWriteModeEnum write_mode_{ViewWriteModeEnum::RawBinaryCompressed};
+  ViewFormatEnum format_{ViewFormatEnum::Vtu};
+  int compression_level_{kVtuCompressionLevel};
+  bool is_incremental_{false};
+  bool is_follow_{false};
+  int follow_interval_{1};
+  int follow_timeout_{60};
   int iteration_order_;
   std::filesystem::path output_directory_;
   std::string output_file_name_prefix_;
   std::fstream error_fin_;
   std::vector<ViewVariableEnum> variable_type_;
+  std::vector<ViewVariableComponent> variable_component_;
+  bool is_sound_speed_needed_{false};
+  std::vector<vtu11::DataSetInfo> data_set_information_;
+  std::vector<std::vector<Isize>> physical_element_index_;
+  XdmfSubCell xdmf_sub_cell_;
+  std::vector<XdmfTopologyNumber> xdmf_topology_number_;
+  std::vector<PhysicalInformation> subset_physical_;
+  std::mutex xdmf_mutex_;
   Eigen::Vector<Real, Eigen::Dynamic> time_value_;
+  int time_value_number_{0};
+  ViewManifest manifest_;
+  std::deque<ViewManifest> subset_manifest_;
+  ViewSolver<SimulationControl> solver_;
+
+  inline std::filesystem::path getViewDirectory() const {
+    return this->output_directory_ / (this->format_ == ViewFormatEnum::Xdmf ? "xdmf" : "vtu");
+  }
 
   inline std::string getBaseName(int step, std::string_view physical_name);
 
+  inline std::string getXdmfMeshFileName(std::string_view physical_name);
+
+  inline bool isViewPhysical(const PhysicalInformation& physical);
+
+  inline const PhysicalInformation& getViewPhysical(const MeshInformation& information, Isize physical_index) const;
+
+  inline void scheduleView(Isize snapshot_number, int thread_number);
+
+  inline void writePhysicalCollection(Isize physical_index, const PhysicalInformation& physical, int io_interval,
+                                      int iteration_start, int iteration_end);
+
+  inline void writeViewCollection(const MeshInformation& information, int iteration_start, int iteration_end);
+
+  inline void writeSubsetViewCollection(const MeshInformation& information, Isize subset_index, int io_interval,
+                                        int iteration_start, int iteration_end);
+
+  inline std::string getViewSignature();
+
+  inline bool isViewUpToDate(int step, const MeshInformation& information,
+                             const std::filesystem::path& raw_binary_path);
+
+  inline bool isSubsetViewUpToDate(int step, Isize subset_index, const std::filesystem::path& raw_binary_path);
+
   inline void getDataSetInfomatoin(std::vector<vtu11::DataSetInfo>& data_set_information);
 
+  inline void resolveViewVariable();
+
+  inline void initializeViewIndex(const MeshInformation& information);
+
+  inline void addSubsetPhysical(const PhysicalInformation& physical, const std::vector<Isize>& element_index);
+
   template <typename ElementTrait>
   inline void calculateViewVariable(const PhysicalModel<SimulationControl>& physical_model,
                                     const ViewVariable<ElementTrait, SimulationControl>& view_variable,
                                     Eigen::Array<Eigen::Vector<Real, Eigen::Dynamic>, Eigen::Dynamic, 1>& node_variable,
-                                    Isize column, Isize node_index);
+                                    Isize node_index);
 
   template <typename AdjacencyElementTrait, typename ElementTrait>
   inline void calculateAdjacencyForce(const AdjacencyElementMesh<AdjacencyElementTrait>& adjacency_element_mesh,
@@ -288,33 +510,50 @@ struct View {
                                       Isize column);
 
   template <typename AdjacencyElementTrait>
-  inline void writeAdjacencyElement(Isize physical_index, const MeshInformation& mesh_information,
-                                    const AdjacencyElementMesh<AdjacencyElementTrait>& adjacency_element_mesh,
-                                    const PhysicalModel<SimulationControl>& physical_model,
-                                    const ViewData<SimulationControl>& view_data, Isize element_index,
-                                    ViewSupplemental<SimulationControl>& view_supplemental);
+  inline void writeAdjacencyElement(
+      Isize physical_index, const AdjacencyElementMesh<AdjacencyElementTrait>& adjacency_element_mesh,
+      const PhysicalModel<SimulationControl>& physical_model, const ViewData<SimulationControl>& view_data,
+      const Eigen::Map<const Eigen::Vector<Real, Eigen::Dynamic>>& node_artificial_viscosity, Isize element_index,
+      ViewIndex<SimulationControl>& view_index, ViewSupplemental<SimulationControl>& view_supplemental);
 
   template <typename ElementTrait>
-  inline void writeElement(Isize physical_index, const MeshInformation& mesh_information,
-                           const ElementMesh<ElementTrait>& element_mesh,
+  inline void writeElement(Isize physical_index, const ElementMesh<ElementTrait>& element_mesh,
                            const PhysicalModel<SimulationControl>& physical_model,
-                           const ViewData<SimulationControl>& view_data, Isize element_index,
+                           const ViewData<SimulationControl>& view_data,
+                           const Eigen::Map<const Eigen::Vector<Real, Eigen::Dynamic>>& node_artificial_viscosity,
+                           Isize element_index, ViewIndex<SimulationControl>& view_index,
                            ViewSupplemental<SimulationControl>& view_supplemental);
 
   template <int Dimension, bool IsAdjacency>
   inline void writeField(Isize physical_index, const Mesh<SimulationControl>& mesh,
                          const PhysicalModel<SimulationControl>& physical_model,
-                         const ViewData<SimulationControl>& view_data,
+                         const ViewData<SimulationControl>& view_data, Isize element_begin, Isize element_end,
                          ViewSupplemental<SimulationControl>& view_supplemental);
 
+  inline void writeViewFile(int step, const Eigen::Vector<Real, SimulationControl::kDimension>& force,
+                            ViewSupplemental<SimulationControl>& view_supplemental,
+                            const std::filesystem::path& view_file_path);
+
+  inline void writePartitionIndex(const std::string& base_name, Isize partition_number);
+
+  inline void writeXdmfMesh(Isize physical_index, const PhysicalInformation& physical,
+                            const ViewSupplemental<SimulationControl>& view_supplemental);
+
+  inline void writeXdmfPhysicalCollection(Isize physical_index, const PhysicalInformation& physical, int io_interval,
+                                          int iteration_start, int iteration_end);
+
   template <int Dimension, bool IsAdjacency>
   inline void writeView(int step, Isize physical_index, const Mesh<SimulationControl>& mesh,
                         const PhysicalModel<SimulationControl>& physical_model,
-                        const ViewData<SimulationControl>& view_data, const std::string& base_name);
+                        ViewData<SimulationControl>& view_data, const std::string& base_name);
 
   inline void stepView(int step, const Mesh<SimulationControl>& mesh,
                        const PhysicalModel<SimulationControl>& physical_model, ViewData<SimulationControl>& view_data);
 
+  inline void stepSubsetView(int step, Isize subset_index, const Mesh<SimulationControl>& mesh,
+                             const PhysicalModel<SimulationControl>& physical_model,
+                             ViewData<SimulationControl>& view_data);
+
   inline void initializeSolverFinout(const bool delete_dir, std::fstream& error_finout) {
     const std::filesystem::path raw_output_directory = this->output_directory_ / "raw";
     std::ios::openmode open_mode = std::ios::in | std::ios::out;
@@ -336,8 +575,8 @@ struct View {
 
   inline void finalizeSolverFinout(std::fstream& error_finout) { error_finout.close(); }
 
-  inline void initializeViewFin(const bool delete_dir, const int iteration_end) {
-    const std::filesystem::path view_output_directory = this->output_directory_ / "vtu";
+  inline void initializeViewDirectory(const bool delete_dir) {
+    const std::filesystem::path view_output_directory = this->getViewDirectory();
     if (delete_dir && SimulationControl::kInitialCondition != InitialConditionEnum::LastStep) {
       if (std::filesystem::exists(view_output_directory)) {
         std::filesystem::remove_all(view_output_directory);
@@ -348,22 +587,78 @@ struct View {
         std::filesystem::create_directories(view_output_directory);
       }
     }
+  }
+
+  inline void initializeViewFin(const bool delete_dir, const int iteration_end) {
+    this->initializeViewDirectory(delete_dir && !this->is_incremental_);
     this->error_fin_.open((this->output_directory_ / "error.txt").string(), std::ios::in);
     this->readTimeValue(iteration_end);
+    if (this->is_incremental_) {
+      this->manifest_.open(this->getViewDirectory() / std::format("{}.manifest", this->output_file_name_prefix_),
+                           this->getViewSignature());
+    }
   }
 
-  inline void readTimeValue(const int iteration_end) {
+  // NOTE: The solver renames a raw binary file into place only after it is fully written, so a file that exists can be
+  // read. Without the follow mode a missing file is left to the reader to report.
+  inline bool waitRawBinary(const std::filesystem::path& raw_binary_path) {
+    if (!this->is_follow_) {
+      return true;
+    }
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(this->follow_timeout_);
+    while (!std::filesystem::exists(raw_binary_path)) {
+      if (std::chrono::steady_clock::now() >= deadline) {
+        return false;
+      }
+      std::this_thread::sleep_for(std::chrono::seconds(this->follow_interval_));
+    }
+    return true;
+  }
+
+  inline void recordView(const int step, const std::filesystem::path& raw_binary_path) {
+    if (this->is_incremental_) {
+      this->manifest_.record(step, getRawBinaryTime(raw_binary_path));
+    }
+  }
+
+  inline void recordSubsetView(const int step, const Isize subset_index,
+                               const std::filesystem::path& raw_binary_path) {
+    if (this->is_incremental_) {
+      this->subset_manifest_[static_cast<Usize>(subset_index)].record(step, getRawBinaryTime(raw_binary_path));
+    }
+  }
+
+  // NOTE: The error file is still being written during the solve, the time values follow the same rule as the ones the
+  // solver writes into it.
+  inline void initializeInSituView(const bool delete_dir, const int iteration_end, const Real delta_time) {
+    this->initializeViewDirectory(delete_dir);
     this->time_value_.resize(iteration_end + 1);
+    for (int i = 0; i <= iteration_end; i++) {
+      this->time_value_(i) = static_cast<Real>(i) * delta_time;
+    }
+  }
+
+  // NOTE: A solve that is still running has not written every line yet, the time values of the later steps are then
+  // taken from the raw binary headers.
+  inline void readTimeValue(const int iteration_end) {
+    this->time_value_.setZero(iteration_end + 1);
+    this->time_value_number_ = 0;
     std::string line;
     std::getline(this->error_fin_, line);
-    for (int i = 0; i <= iteration_end; i++) {
-      std::getline(this->error_fin_, line);
+    for (int i = 0; i <= iteration_end && std::getline(this->error_fin_, line); i++) {
       std::stringstream ss(line);
       ss.ignore(2) >> this->time_value_(i);
+      this->time_value_number_++;
     }
   }
 
-  inline void finalizeViewFin() { this->error_fin_.close(); }
+  inline void finalizeViewFin() {
+    this->error_fin_.close();
+    this->manifest_.close();
+    for (ViewManifest& subset_manifest : this->subset_manifest_) {
+      subset_manifest.close();
+    }
+  }
 };
 
 }  // namespace SubrosaDG
@@ -0,0 +1,366 @@
+/**
+ * @file OutputSubset.cpp
+ * @brief The header file of SubrosaDG output subset.
+ *
+ * @author Yufei.Liu, Calm.Liu@outlook.com | Chenyu.Bao, bcynuaa@163.com
+ * @date 2025-04-17
+ *
+ * @version 0.1.0
+ * @copyright Copyright (c) 2022 - 2025 by SubrosaDG developers. All rights reserved.
+ * SubrosaDG is free software and is distributed under the MIT license.
+ */
+
+#ifndef SUBROSA_DG_OUTPUT_SUBSET_CPP_
+#define SUBROSA_DG_OUTPUT_SUBSET_CPP_
+
+#include <oneapi/tbb.h>
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <magic_enum/magic_enum.hpp>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Mesh/ReadControl.cpp"
+#include "Solver/SimulationControl.cpp"
+#include "Solver/SolveControl.cpp"
+#include "Solver/TimeIntegration.cpp"
+#include "Utils/BasicDataType.cpp"
+#include "Utils/Concept.cpp"
+#include "Utils/Constant.cpp"
+#include "Utils/Enum.cpp"
+#include "Utils/ParallelControl.cpp"
+#include "View/RawBinary.cpp"
+#include "View/RawBinaryCompress.cpp"
+
+namespace SubrosaDG {
+
+// NOTE: A subset snapshot holds, for each element type, the full raw binary of the selected elements followed by their
+// element indices, and then the artificial viscosity of the nodes of the selected elements in increasing node order.
+// The selection is made once from the physical groups, the boxes and the spheres, an element belongs to the subset when
+// it is in one of the groups or its center lies in one of the boxes or spheres. The view expands a subset snapshot into
+// the layout of a full snapshot and writes the subset as its own physical group.
+template <typename SimulationControl>
+struct OutputSubset {
+  std::string name_;
+  int io_interval_{1};
+  std::vector<Isize> physical_index_;
+  std::vector<std::pair<Eigen::Vector<Real, SimulationControl::kDimension>,
+                        Eigen::Vector<Real, SimulationControl::kDimension>>>
+      box_;
+  std::vector<std::pair<Eigen::Vector<Real, SimulationControl::kDimension>, Real>> sphere_;
+  PhysicalInformation physical_;
+  std::vector<Isize> element_index_;
+  std::vector<Isize> node_index_;
+  RawBinaryHeader raw_binary_header_;
+  std::vector<RawBinaryBlock> raw_binary_block_;
+  std::vector<char> raw_binary_;
+
+  [[nodiscard]] inline std::filesystem::path getRawBinaryPath(const std::filesystem::path& output_directory,
+                                                              const std::string& output_file_name_prefix,
+                                                              const int step) const {
+    return output_directory / std::format("subset/{}_{}_{}.zst", output_file_name_prefix, this->name_, step);
+  }
+
+  template <typename ElementTrait>
+  [[nodiscard]] inline bool isElementSelected(const PerElementMesh<ElementTrait>& element) const {
+    if (std::ranges::find(this->physical_index_, element.gmsh_physical_index_) != this->physical_index_.end()) {
+      return true;
+    }
+    const Eigen::Vector<Real, SimulationControl::kDimension> center = element.node_coordinate_.rowwise().mean();
+    for (const auto& [minimum, maximum] : this->box_) {
+      if ((center.array() >= minimum.array()).all() && (center.array() <= maximum.array()).all()) {
+        return true;
+      }
+    }
+    for (const auto& [sphere_center, radius] : this->sphere_) {
+      if ((center - sphere_center).squaredNorm() <= radius * radius) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  template <typename ElementTrait>
+  inline void addElement(const ElementMesh<ElementTrait>& element_mesh) {
+    for (Isize i = 0; i < element_mesh.number_; i++) {
+      if (this->isElementSelected(element_mesh.element_(i))) {
+        this->element_index_.emplace_back(i);
+        for (const Isize node_tag : element_mesh.element_(i).node_tag_) {
+          this->node_index_.emplace_back(node_tag - 1);
+        }
+        this->physical_.element_gmsh_type_.emplace_back(ElementTrait::kGmshTypeNumber);
+        this->physical_.element_gmsh_tag_.emplace_back(element_mesh.element_(i).gmsh_tag_);
+        this->physical_.element_number_++;
+        this->physical_.vtk_element_number_ += ElementTrait::kVtkElementNumber;
+        this->physical_.node_number_ += ElementTrait::kAllNodeNumber;
+        this->physical_.vtk_node_number_ += ElementTrait::kVtkAllNodeNumber;
+      }
+    }
+  }
+
+  // NOTE: The elements of one type are contiguous in the subset, so each type is one range of the element indices.
+  template <typename ElementTrait>
+  [[nodiscard]] inline std::pair<Isize, Isize> getElementRange() const {
+    const auto begin = std::ranges::find(this->physical_.element_gmsh_type_, ElementTrait::kGmshTypeNumber);
+    const auto end = std::find_if(begin, this->physical_.element_gmsh_type_.end(), [](const int gmsh_type) {
+      return gmsh_type != ElementTrait::kGmshTypeNumber;
+    });
+    return {begin - this->physical_.element_gmsh_type_.begin(), end - this->physical_.element_gmsh_type_.begin()};
+  }
+
+  template <typename ElementTrait>
+  inline void addElementRawBinaryBlock(std::size_t& raw_binary_offset) {
+    const auto [element_begin, element_end] = this->getElementRange<ElementTrait>();
+    if (element_begin == element_end) {
+      return;
+    }
+    RawBinaryBlock& element_block = this->raw_binary_block_.emplace_back();
+    element_block.type_ = magic_enum::enum_integer(RawBinaryBlockEnum::Element);
+    element_block.gmsh_type_number_ = ElementTrait::kGmshTypeNumber;
+    element_block.number_ = static_cast<std::int32_t>(element_end - element_begin);
+    element_block.shuffle_size_ = static_cast<std::int32_t>(sizeof(Real));
+    element_block.offset_ = raw_binary_offset;
+    element_block.size_ = static_cast<std::size_t>(element_end - element_begin) *
+                          getElementRawBinarySize<ElementTrait, SimulationControl>();
+    raw_binary_offset += element_block.size_;
+    RawBinaryBlock& element_index_block = this->raw_binary_block_.emplace_back();
+    element_index_block.type_ = magic_enum::enum_integer(RawBinaryBlockEnum::ElementIndex);
+    element_index_block.gmsh_type_number_ = ElementTrait::kGmshTypeNumber;
+    element_index_block.number_ = static_cast<std::int32_t>(element_end - element_begin);
+    element_index_block.shuffle_size_ = static_cast<std::int32_t>(sizeof(std::int64_t));
+    element_index_block.offset_ = raw_binary_offset;
+    element_index_block.size_ = static_cast<std::size_t>(element_end - element_begin) * sizeof(std::int64_t);
+    raw_binary_offset += element_index_block.size_;
+  }
+
+  inline void initializeOutputSubset(const Mesh<SimulationControl>& mesh) {
+    for (const Isize physical_index : this->physical_index_) {
+      if (physical_index < 1 || physical_index > mesh.information_.physical_number_ ||
+          mesh.information_.physical_[static_cast<Usize>(physical_index) - 1].dimension_ !=
+              SimulationControl::kDimension) [[unlikely]] {
+        throw std::runtime_error(
+            std::format("Physical group {} of output subset {} is not a part of the computational domain.",
+                        physical_index, this->name_));
+      }
+    }
+    if (std::ranges::any_of(mesh.information_.physical_,
+                            [this](const PhysicalInformation& physical) { return physical.name_ == this->name_; }))
+        [[unlikely]] {
+      throw std::runtime_error(std::format("Output subset {} has the name of a physical group.", this->name_));
+    }
+    this->physical_ = PhysicalInformation{.dimension_ = SimulationControl::kDimension, .name_ = this->name_};
+    this->element_index_.clear();
+    this->node_index_.clear();
+    if constexpr (SimulationControl::kDimension == 1) {
+      this->addElement(mesh.line_);
+    } else if constexpr (SimulationControl::kDimension == 2) {
+      if constexpr (HasTriangle<SimulationControl::kMeshModel>) {
+        this->addElement(mesh.triangle_);
+      }
+      if constexpr (HasQuadrangle<SimulationControl::kMeshModel>) {
+        this->addElement(mesh.quadrangle_);
+      }
+    } else if constexpr (SimulationControl::kDimension == 3) {
+      if constexpr (HasTetrahedron<SimulationControl::kMeshModel>) {
+        this->addElement(mesh.tetrahedron_);
+      }
+      if constexpr (HasPyramid<SimulationControl::kMeshModel>) {
+        this->addElement(mesh.pyramid_);
+      }
+      if constexpr (HasHexahedron<SimulationControl::kMeshModel>) {
+        this->addElement(mesh.hexahedron_);
+      }
+    }
+    if (this->physical_.element_number_ == 0) [[unlikely]] {
+      throw std::runtime_error(std::format("Output subset {} has no element.", this->name_));
+    }
+    std::ranges::sort(this->node_index_);
+    const auto duplicate_node_index = std::ranges::unique(this->node_index_);
+    this->node_index_.erase(duplicate_node_index.begin(), duplicate_node_index.end());
+    std::size_t raw_binary_offset = 0;
+    this->raw_binary_block_.clear();
+    if constexpr (SimulationControl::kDimension == 1) {
+      this->addElementRawBinaryBlock<LineTrait<SimulationControl::kPolynomialOrder>>(raw_binary_offset);
+    } else if constexpr (SimulationControl::kDimension == 2) {
+      this->addElementRawBinaryBlock<TriangleTrait<SimulationControl::kPolynomialOrder>>(raw_binary_offset);
+      this->addElementRawBinaryBlock<QuadrangleTrait<SimulationControl::kPolynomialOrder>>(raw_binary_offset);
+    } else if constexpr (SimulationControl::kDimension == 3) {
+      this->addElementRawBinaryBlock<TetrahedronTrait<SimulationControl::kPolynomialOrder>>(raw_binary_offset);
+      this->addElementRawBinaryBlock<PyramidTrait<SimulationControl::kPolynomialOrder>>(raw_binary_offset);
+      this->addElementRawBinaryBlock<HexahedronTrait<SimulationControl::kPolynomialOrder>>(raw_binary_offset);
+    }
+    RawBinaryBlock& node_artificial_viscosity_block = this->raw_binary_block_.emplace_back();
+    node_artificial_viscosity_block.type_ = magic_enum::enum_integer(RawBinaryBlockEnum::NodeArtificialViscosity);
+    node_artificial_viscosity_block.number_ = static_cast<std::int32_t>(this->node_index_.size());
+    node_artificial_viscosity_block.shuffle_size_ = static_cast<std::int32_t>(sizeof(Real));
+    node_artificial_viscosity_block.offset_ = raw_binary_offset;
+    node_artificial_viscosity_block.size_ = this->node_index_.size() * sizeof(Real);
+  }
+
+  template <typename ElementTrait>
+  inline void packElementRawBinary(const Solver<SimulationControl>& solver) {
+    constexpr std::size_t kBasisFunctionCoefficientSize{
+        static_cast<std::size_t>(SimulationControl::kConservedVariableNumber * ElementTrait::kBasisFunctionNumber *
+                                 kRealSize)};
+    constexpr std::size_t kElementRawBinarySize{getElementRawBinarySize<ElementTrait, SimulationControl>()};
+    const auto [element_begin, element_end] = this->getElementRange<ElementTrait>();
+    if (element_begin == element_end) {
+      return;
+    }
+    const ElementSolver<ElementTrait, SimulationControl>& element_solver =
+        solver.*(Solver<SimulationControl>::template getElement<ElementTrait>());
+    const auto block = std::ranges::find_if(this->raw_binary_block_, [](const RawBinaryBlock& raw_binary_block) {
+      return raw_binary_block.type_ == magic_enum::enum_integer(RawBinaryBlockEnum::Element) &&
+             raw_binary_block.gmsh_type_number_ == ElementTrait::kGmshTypeNumber;
+    });
+    const std::size_t element_offset = block->offset_;
+    const std::size_t element_index_offset = std::next(block)->offset_;
+    parallelFor(0, element_end - element_begin, [&](const tbb::blocked_range<Isize>& range) {
+      for (Isize i = range.begin(); i != range.end(); i++) {
+        const Isize element_index = this->element_index_[static_cast<Usize>(element_begin + i)];
+        char* element_raw_binary =
+            this->raw_binary_.data() + element_offset + static_cast<std::size_t>(i) * kElementRawBinarySize;
+        std::memcpy(element_raw_binary,
+                    element_solver.element_(element_index).variable_basis_function_coefficient_.data(),
+                    kBasisFunctionCoefficientSize);
+        if constexpr (IsNS<SimulationControl::kEquationModel>) {
+          std::memcpy(element_raw_binary + kBasisFunctionCoefficientSize,
+                      element_solver.element_(element_index).variable_gradient_basis_function_coefficient_.data(),
+                      kElementRawBinarySize - kBasisFunctionCoefficientSize);
+        }
+        const auto stored_element_index = static_cast<std::int64_t>(element_index);
+        std::memcpy(
+            this->raw_binary_.data() + element_index_offset + static_cast<std::size_t>(i) * sizeof(std::int64_t),
+            &stored_element_index, sizeof(std::int64_t));
+      }
+    });
+  }
+
+  inline void writeRawBinary(const Mesh<SimulationControl>& mesh,
+                             const TimeIntegration<SimulationControl>& time_integration,
+                             Solver<SimulationControl>& solver, const std::filesystem::path& raw_binary_path) {
+    getRawBinaryHeader(mesh, time_integration, RawBinaryTypeEnum::Subset, this->raw_binary_header_);
+    this->raw_binary_.resize(this->raw_binary_block_.back().offset_ + this->raw_binary_block_.back().size_);
+    if constexpr (SimulationControl::kDimension == 1) {
+      this->packElementRawBinary<LineTrait<SimulationControl::kPolynomialOrder>>(solver);
+    } else if constexpr (SimulationControl::kDimension == 2) {
+      this->packElementRawBinary<TriangleTrait<SimulationControl::kPolynomialOrder>>(solver);
+      this->packElementRawBinary<QuadrangleTrait<SimulationControl::kPolynomialOrder>>(solver);
+    } else if constexpr (SimulationControl::kDimension == 3) {
+      this->packElementRawBinary<TetrahedronTrait<SimulationControl::kPolynomialOrder>>(solver);
+      this->packElementRawBinary<PyramidTrait<SimulationControl::kPolynomialOrder>>(solver);
+      this->packElementRawBinary<HexahedronTrait<SimulationControl::kPolynomialOrder>>(solver);
+    }
+    Eigen::Map<Eigen::Vector<Real, Eigen::Dynamic>> node_artificial_viscosity(
+        reinterpret_cast<Real*>(this->raw_binary_.data() + this->raw_binary_block_.back().offset_),
+        static_cast<Isize>(this->node_index_.size()));
+    for (Isize i = 0; i < node_artificial_viscosity.size(); i++) {
+      node_artificial_viscosity(i) = solver.node_artificial_viscosity_(this->node_index_[static_cast<Usize>(i)]);
+    }
+    solver.raw_binary_write_queue_.push(raw_binary_path, this->raw_binary_header_, this->raw_binary_block_,
+                                        this->raw_binary_);
+  }
+
+  inline void checkRawBinary(const std::filesystem::path& raw_binary_path,
+                             const std::vector<RawBinaryBlock>& block) const {
+    if (block.size() != this->raw_binary_block_.size()) [[unlikely]] {
+      throw std::runtime_error(std::format("Raw binary file {} has {} blocks but the output subset {} needs {}.",
+                                           raw_binary_path.string(), block.size(), this->name_,
+                                           this->raw_binary_block_.size()));
+    }
+    for (std::size_t i = 0; i < block.size(); i++) {
+      if (block[i].type_ != this->raw_binary_block_[i].type_ ||
+          block[i].gmsh_type_number_ != this->raw_binary_block_[i].gmsh_type_number_ ||
+          block[i].number_ != this->raw_binary_block_[i].number_ ||
+          block[i].offset_ != this->raw_binary_block_[i].offset_ ||
+          block[i].size_ != this->raw_binary_block_[i].size_) [[unlikely]] {
+        throw std::runtime_error(std::format("Raw binary file {} does not match the output subset {} at block {}.",
+                                             raw_binary_path.string(), this->name_, i));
+      }
+    }
+  }
+
+  template <typename ElementTrait>
+  inline void expandElementRawBinary(const std::filesystem::path& raw_binary_path,
+                                     const std::vector<char>& subset_raw_binary,
+                                     const std::vector<RawBinaryBlock>& block, std::vector<char>& raw_binary) const {
+    constexpr std::size_t kElementRawBinarySize{getElementRawBinarySize<ElementTrait, SimulationControl>()};
+    const auto [element_begin, element_end] = this->getElementRange<ElementTrait>();
+    if (element_begin == element_end) {
+      return;
+    }
+    const auto is_element_block = [](const RawBinaryBlock& raw_binary_block) {
+      return raw_binary_block.type_ == magic_enum::enum_integer(RawBinaryBlockEnum::Element) &&
+             raw_binary_block.gmsh_type_number_ == ElementTrait::kGmshTypeNumber;
+    };
+    const auto subset_block = std::ranges::find_if(this->raw_binary_block_, is_element_block);
+    const std::size_t element_offset = subset_block->offset_;
+    const std::size_t element_index_offset = std::next(subset_block)->offset_;
+    const std::size_t full_element_offset = std::ranges::find_if(block, is_element_block)->offset_;
+    for (Isize i = 0; i < element_end - element_begin; i++) {
+      std::int64_t stored_element_index;
+      std::memcpy(&stored_element_index,
+                  subset_raw_binary.data() + element_index_offset + static_cast<std::size_t>(i) * sizeof(std::int64_t),
+                  sizeof(std::int64_t));
+      if (stored_element_index != this->element_index_[static_cast<Usize>(element_begin + i)]) [[unlikely]] {
+        throw std::runtime_error(std::format("Raw binary file {} is written for another selection of output subset {}.",
+                                             raw_binary_path.string(), this->name_));
+      }
+    }
+    parallelFor(0, element_end - element_begin, [&](const tbb::blocked_range<Isize>& range) {
+      for (Isize i = range.begin(); i != range.end(); i++) {
+        std::memcpy(raw_binary.data() + full_element_offset +
+                        static_cast<std::size_t>(this->element_index_[static_cast<Usize>(element_begin + i)]) *
+                            kElementRawBinarySize,
+                    subset_raw_binary.data() + element_offset + static_cast<std::size_t>(i) * kElementRawBinarySize,
+                    kElementRawBinarySize);
+      }
+    });
+  }
+
+  // NOTE: Only the selected elements and the artificial viscosity of their nodes are filled, the view of the subset
+  // never reads the other elements, the other nodes or the boundary blocks.
+  inline void expandRawBinary(const std::filesystem::path& raw_binary_path, const Mesh<SimulationControl>& mesh,
+                              const std::vector<char>& subset_raw_binary, std::vector<RawBinaryBlock>& block,
+                              std::vector<char>& raw_binary) const {
+    getRawBinaryBlock(mesh, RawBinaryTypeEnum::Full, block);
+    raw_binary.resize(block.back().offset_ + block.back().size_);
+    if constexpr (SimulationControl::kDimension == 1) {
+      this->expandElementRawBinary<LineTrait<SimulationControl::kPolynomialOrder>>(raw_binary_path, subset_raw_binary,
+                                                                                   block, raw_binary);
+    } else if constexpr (SimulationControl::kDimension == 2) {
+      this->expandElementRawBinary<TriangleTrait<SimulationControl::kPolynomialOrder>>(
+          raw_binary_path, subset_raw_binary, block, raw_binary);
+      this->expandElementRawBinary<QuadrangleTrait<SimulationControl::kPolynomialOrder>>(
+          raw_binary_path, subset_raw_binary, block, raw_binary);
+    } else if constexpr (SimulationControl::kDimension == 3) {
+      this->expandElementRawBinary<TetrahedronTrait<SimulationControl::kPolynomialOrder>>(
+          raw_binary_path, subset_raw_binary, block, raw_binary);
+      this->expandElementRawBinary<PyramidTrait<SimulationControl::kPolynomialOrder>>(
+          raw_binary_path, subset_raw_binary, block, raw_binary);
+      this->expandElementRawBinary<HexahedronTrait<SimulationControl::kPolynomialOrder>>(
+          raw_binary_path, subset_raw_binary, block, raw_binary);
+    }
+    const Eigen::Map<const Eigen::Vector<Real, Eigen::Dynamic>> subset_node_artificial_viscosity(
+        reinterpret_cast<const Real*>(subset_raw_binary.data() + this->raw_binary_block_.back().offset_),
+        static_cast<Isize>(this->node_index_.size()));
+    Eigen::Map<Eigen::Vector<Real, Eigen::Dynamic>> node_artificial_viscosity(
+        reinterpret_cast<Real*>(raw_binary.data() + block.back().offset_), mesh.node_number_);
+    for (Isize i = 0; i < subset_node_artificial_viscosity.size(); i++) {
+      node_artificial_viscosity(this->node_index_[static_cast<Usize>(i)]) = subset_node_artificial_viscosity(i);
+    }
+  }
+};
+
+}  // namespace SubrosaDG
+
+#endif  // SUBROSA_DG_OUTPUT_SUBSET_CPP_
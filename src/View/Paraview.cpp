@@ -13,13 +13,20 @@
 #ifndef SUBROSA_DG_PARAVIEW_CPP_
 #define SUBROSA_DG_PARAVIEW_CPP_
 
+#include <oneapi/tbb.h>
+
 #include <Eigen/Core>
+#include <algorithm>
 #include <array>
+#include <filesystem>
 #include <format>
+#include <fstream>
 #include <magic_enum/magic_enum.hpp>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 #include <vtu11-cpp17.hpp>
 
@@ -31,12 +38,143 @@
 #include "Utils/Concept.cpp"
 #include "Utils/Enum.cpp"
 #include "View/IOControl.cpp"
+#include "View/VtuWriter.cpp"
+#include "View/XdmfWriter.cpp"
 
 namespace SubrosaDG {
 
 template <typename SimulationControl>
 inline std::string View<SimulationControl>::getBaseName(const int step, const std::string_view physical_name) {
-  return std::format("{}_{}_{:0{}d}.vtu", this->output_file_name_prefix_, physical_name, step, this->iteration_order_);
+  std::string_view extension = this->partition_number_ > 1 ? "pvtu" : "vtu";
+  if (this->format_ == ViewFormatEnum::Xdmf) {
+    extension = "bin";
+  }
+  return std::format("{}_{}_{:0{}d}.{}", this->output_file_name_prefix_, physical_name, step, this->iteration_order_,
+                     extension);
+}
+
+template <typename SimulationControl>
+inline std::string View<SimulationControl>::getXdmfMeshFileName(const std::string_view physical_name) {
+  return std::format("{}_{}_mesh.bin", this->output_file_name_prefix_, physical_name);
+}
+
+template <typename SimulationControl>
+inline bool View<SimulationControl>::isViewPhysical(const PhysicalInformation& physical) {
+  if (physical.dimension_ == SimulationControl::kDimension - 1 && !isWall(physical.boundary_condition_type_)) {
+    return false;
+  }
+  return physical.dimension_ >= std::ranges::max(SimulationControl::kDimension - 1, 1);
+}
+
+// NOTE: With at least one snapshot per thread the steps alone keep every thread busy and the elements of a step are
+// written in order, otherwise each step is cut into a few chunks per thread so that one large snapshot uses them all.
+template <typename SimulationControl>
+inline void View<SimulationControl>::scheduleView(const Isize snapshot_number, const int thread_number) {
+  this->element_chunk_number_ = snapshot_number >= thread_number ? 1 : kViewElementChunkFactor * thread_number;
+}
+
+// NOTE: The output subsets are viewed as physical groups after the ones of the mesh, their elements are kept in the
+// element indices of the view and their information in the view itself.
+template <typename SimulationControl>
+inline const PhysicalInformation& View<SimulationControl>::getViewPhysical(const MeshInformation& information,
+                                                                         const Isize physical_index) const {
+  if (physical_index < information.physical_number_) {
+    return information.physical_[static_cast<Usize>(physical_index)];
+  }
+  return this->subset_physical_[static_cast<Usize>(physical_index - information.physical_number_)];
+}
+
+// NOTE: One .pvd file per physical group lists the files of every written step with its time value, so ParaView opens
+// the whole series with the right time axis. Steps without a file on disk are left out, so a collection built from step
+// 0 after a restart only lists what the earlier runs actually wrote.
+template <typename SimulationControl>
+inline void View<SimulationControl>::writePhysicalCollection(const Isize physical_index,
+                                                             const PhysicalInformation& physical,
+                                                             const int io_interval, const int iteration_start,
+                                                             const int iteration_end) {
+  if (this->format_ == ViewFormatEnum::Xdmf) {
+    this->writeXdmfPhysicalCollection(physical_index, physical, io_interval, iteration_start, iteration_end);
+    return;
+  }
+  std::fstream collection_fout(
+      this->getViewDirectory() / std::format("{}_{}.pvd", this->output_file_name_prefix_, physical.name_),
+      std::ios::out | std::ios::trunc);
+  collection_fout << "<?xml version=\"1.0\"?>\n";
+  collection_fout << "<VTKFile type=\"Collection\" version=\"0.1\" byte_order=\"LittleEndian\">\n";
+  collection_fout << "  <Collection>\n";
+  for (int i = iteration_start; i <= iteration_end; i++) {
+    if (i % io_interval == 0 &&
+        std::filesystem::exists(this->getViewDirectory() / this->getBaseName(i, physical.name_))) {
+      collection_fout << std::format("    <DataSet timestep=\"{}\" part=\"0\" file=\"{}\"/>\n", this->time_value_(i),
+                                     this->getBaseName(i, physical.name_));
+    }
+  }
+  collection_fout << "  </Collection>\n";
+  collection_fout << "</VTKFile>\n";
+  collection_fout.close();
+}
+
+template <typename SimulationControl>
+inline void View<SimulationControl>::writeViewCollection(const MeshInformation& information, const int iteration_start,
+                                                         const int iteration_end) {
+  for (Isize i = 0; i < information.physical_number_; i++) {
+    if (!this->isViewPhysical(information.physical_[static_cast<Usize>(i)])) {
+      continue;
+    }
+    this->writePhysicalCollection(i, information.physical_[static_cast<Usize>(i)], this->io_interval_,
+                                  iteration_start, iteration_end);
+  }
+}
+
+// NOTE: A subset lists only the steps of its own interval, the steps after the last written one are left out.
+template <typename SimulationControl>
+inline void View<SimulationControl>::writeSubsetViewCollection(const MeshInformation& information,
+                                                               const Isize subset_index, const int io_interval,
+                                                               const int iteration_start, const int iteration_end) {
+  this->writePhysicalCollection(information.physical_number_ + subset_index,
+                                this->subset_physical_[static_cast<Usize>(subset_index)], io_interval,
+                                iteration_start, iteration_end);
+}
+
+// NOTE: Any setting that changes the content or the names of the output files is part of the signature, so a manifest
+// written with other settings makes every step stale.
+template <typename SimulationControl>
+inline std::string View<SimulationControl>::getViewSignature() {
+  std::string signature =
+      std::format("{} {} {} {} {}", magic_enum::enum_name(this->format_), magic_enum::enum_name(this->write_mode_),
+                  this->compression_level_, this->partition_number_, this->iteration_order_);
+  for (const auto variable : this->variable_type_) {
+    signature += std::format(" {}", magic_enum::enum_name(variable));
+  }
+  return signature;
+}
+
+template <typename SimulationControl>
+inline bool View<SimulationControl>::isViewUpToDate(const int step, const MeshInformation& information,
+                                                    const std::filesystem::path& raw_binary_path) {
+  if (!this->is_incremental_ || !std::filesystem::exists(raw_binary_path) ||
+      !this->manifest_.isUpToDate(step, getRawBinaryTime(raw_binary_path))) {
+    return false;
+  }
+  for (const PhysicalInformation& physical : information.physical_) {
+    if (this->isViewPhysical(physical) &&
+        !std::filesystem::exists(this->getViewDirectory() / this->getBaseName(step, physical.name_))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// NOTE: Each subset has its own manifest since its steps follow its own interval.
+template <typename SimulationControl>
+inline bool View<SimulationControl>::isSubsetViewUpToDate(const int step, const Isize subset_index,
+                                                          const std::filesystem::path& raw_binary_path) {
+  if (!this->is_incremental_ || !std::filesystem::exists(raw_binary_path) ||
+      !this->subset_manifest_[static_cast<Usize>(subset_index)].isUpToDate(step, getRawBinaryTime(raw_binary_path))) {
+    return false;
+  }
+  const PhysicalInformation& physical = this->subset_physical_[static_cast<Usize>(subset_index)];
+  return std::filesystem::exists(this->getViewDirectory() / this->getBaseName(step, physical.name_));
 }
 
 template <typename SimulationControl>
@@ -57,40 +195,103 @@ inline void View<SimulationControl>::getDataSetInfomatoin(std::vector<vtu11::Dat
 }
 
 template <typename SimulationControl>
-template <typename ElementTrait>
-inline void View<SimulationControl>::calculateViewVariable(
-    const PhysicalModel<SimulationControl>& physical_model,
-    const ViewVariable<ElementTrait, SimulationControl>& view_variable,
-    Eigen::Array<Eigen::Vector<Real, Eigen::Dynamic>, Eigen::Dynamic, 1>& node_variable, const Isize column,
-    const Isize node_index) {
-  auto handle_variable = [&](Isize i, ViewVariableEnum variable_x, ViewVariableEnum variable_y,
-                             ViewVariableEnum variable_z) -> void {
+inline void View<SimulationControl>::resolveViewVariable() {
+  this->data_set_information_.clear();
+  this->getDataSetInfomatoin(this->data_set_information_);
+  this->variable_component_.clear();
+  const auto add_variable = [&](const Isize i, const ViewVariableEnum variable_x, const ViewVariableEnum variable_y,
+                                const ViewVariableEnum variable_z) {
     if constexpr (SimulationControl::kDimension == 1) {
-      node_variable(i)(node_index) = view_variable.get(physical_model, variable_x, column);
-    } else if constexpr (SimulationControl::kDimension == 2) {
-      node_variable(i)(node_index * 3) = view_variable.get(physical_model, variable_x, column);
-      node_variable(i)(node_index * 3 + 1) = view_variable.get(physical_model, variable_y, column);
-      node_variable(i)(node_index * 3 + 2) = 0.0_r;
-    } else if constexpr (SimulationControl::kDimension == 3) {
-      node_variable(i)(node_index * 3) = view_variable.get(physical_model, variable_x, column);
-      node_variable(i)(node_index * 3 + 1) = view_variable.get(physical_model, variable_y, column);
-      node_variable(i)(node_index * 3 + 2) = view_variable.get(physical_model, variable_z, column);
+      this->variable_component_.push_back({i, 1, 0, variable_x});
+    } else {
+      this->variable_component_.push_back({i, 3, 0, variable_x});
+      this->variable_component_.push_back({i, 3, 1, variable_y});
+      this->variable_component_.push_back({i, 3, 2, variable_z, SimulationControl::kDimension == 2});
     }
   };
   for (Isize i = 0; i < static_cast<Isize>(this->variable_type_.size()); i++) {
     if (this->variable_type_[static_cast<Usize>(i)] == ViewVariableEnum::Velocity) {
-      handle_variable(i, ViewVariableEnum::VelocityX, ViewVariableEnum::VelocityY, ViewVariableEnum::VelocityZ);
+      add_variable(i, ViewVariableEnum::VelocityX, ViewVariableEnum::VelocityY, ViewVariableEnum::VelocityZ);
     } else if (this->variable_type_[static_cast<Usize>(i)] == ViewVariableEnum::MachNumber) {
-      handle_variable(i, ViewVariableEnum::MachNumberX, ViewVariableEnum::MachNumberY, ViewVariableEnum::MachNumberZ);
+      add_variable(i, ViewVariableEnum::MachNumberX, ViewVariableEnum::MachNumberY, ViewVariableEnum::MachNumberZ);
     } else if (this->variable_type_[static_cast<Usize>(i)] == ViewVariableEnum::Vorticity &&
                SimulationControl::kDimension == 3) {
-      handle_variable(i, ViewVariableEnum::VorticityX, ViewVariableEnum::VorticityY, ViewVariableEnum::VorticityZ);
+      add_variable(i, ViewVariableEnum::VorticityX, ViewVariableEnum::VorticityY, ViewVariableEnum::VorticityZ);
     } else if (this->variable_type_[static_cast<Usize>(i)] == ViewVariableEnum::HeatFlux) {
-      handle_variable(i, ViewVariableEnum::HeatFluxX, ViewVariableEnum::HeatFluxY, ViewVariableEnum::HeatFluxZ);
+      add_variable(i, ViewVariableEnum::HeatFluxX, ViewVariableEnum::HeatFluxY, ViewVariableEnum::HeatFluxZ);
+    } else {
+      this->variable_component_.push_back({i, 1, 0, this->variable_type_[static_cast<Usize>(i)]});
+    }
+  }
+  this->is_sound_speed_needed_ =
+      std::ranges::any_of(this->variable_component_, [](const ViewVariableComponent& component) {
+        return !component.is_zero_ && (component.variable_type_ == ViewVariableEnum::SoundSpeed ||
+                                       component.variable_type_ == ViewVariableEnum::MachNumber ||
+                                       component.variable_type_ == ViewVariableEnum::MachNumberX ||
+                                       component.variable_type_ == ViewVariableEnum::MachNumberY ||
+                                       component.variable_type_ == ViewVariableEnum::MachNumberZ);
+      });
+}
+
+// NOTE: The index of every element of a physical group in its element type is looked up in the hash map only once, the
+// writers of all later snapshots read it from the flat table.
+template <typename SimulationControl>
+inline void View<SimulationControl>::initializeViewIndex(const MeshInformation& information) {
+  this->physical_element_index_.resize(static_cast<Usize>(information.physical_number_));
+  this->xdmf_topology_number_.assign(static_cast<Usize>(information.physical_number_), {});
+  if (this->format_ == ViewFormatEnum::Xdmf) {
+    this->xdmf_sub_cell_.template initializeXdmfSubCell<SimulationControl::kPolynomialOrder>();
+  }
+  for (Isize i = 0; i < information.physical_number_; i++) {
+    const PhysicalInformation& physical = information.physical_[static_cast<Usize>(i)];
+    std::vector<Isize>& element_index = this->physical_element_index_[static_cast<Usize>(i)];
+    element_index.resize(static_cast<Usize>(physical.element_number_));
+    for (Isize j = 0; j < physical.element_number_; j++) {
+      element_index[static_cast<Usize>(j)] =
+          information.gmsh_tag_to_element_physical_information_.at(physical.element_gmsh_tag_[static_cast<Usize>(j)])
+              .element_index_;
+    }
+  }
+  this->subset_physical_.clear();
+  this->subset_manifest_.clear();
+}
+
+template <typename SimulationControl>
+inline void View<SimulationControl>::addSubsetPhysical(const PhysicalInformation& physical,
+                                                       const std::vector<Isize>& element_index) {
+  this->subset_physical_.emplace_back(physical);
+  this->physical_element_index_.emplace_back(element_index);
+  this->xdmf_topology_number_.emplace_back();
+  ViewManifest& subset_manifest = this->subset_manifest_.emplace_back();
+  if (this->is_incremental_) {
+    subset_manifest.open(
+        this->getViewDirectory() / std::format("{}_{}.manifest", this->output_file_name_prefix_, physical.name_),
+        this->getViewSignature());
+  }
+}
+
+// NOTE: The variable list is resolved once in resolveViewVariable, each output row is then one array operation over all
+// nodes of the element and the sound speed is computed at most once per element.
+template <typename SimulationControl>
+template <typename ElementTrait>
+inline void View<SimulationControl>::calculateViewVariable(
+    const PhysicalModel<SimulationControl>& physical_model,
+    const ViewVariable<ElementTrait, SimulationControl>& view_variable,
+    Eigen::Array<Eigen::Vector<Real, Eigen::Dynamic>, Eigen::Dynamic, 1>& node_variable, const Isize node_index) {
+  Eigen::Array<Real, 1, ElementTrait::kBasisFunctionNumber> sound_speed;
+  if (this->is_sound_speed_needed_) {
+    sound_speed = view_variable.getSoundSpeed(physical_model);
+  }
+  Eigen::Array<Real, 1, ElementTrait::kBasisFunctionNumber> row;
+  for (const auto& [variable_index, stride, offset, variable_type, is_zero] : this->variable_component_) {
+    if (is_zero) {
+      row.setZero();
     } else {
-      node_variable(i)(node_index) =
-          view_variable.get(physical_model, this->variable_type_[static_cast<Usize>(i)], column);
+      view_variable.getRow(physical_model, variable_type, sound_speed, row);
     }
+    node_variable(variable_index)(Eigen::seqN(node_index * stride + offset, Eigen::fix<ElementTrait::kAllNodeNumber>,
+                                              stride)) =
+        row.template head<ElementTrait::kAllNodeNumber>().matrix().transpose();
   }
 }
 
@@ -106,152 +307,231 @@ inline void View<SimulationControl>::calculateAdjacencyForce(
            adjacency_element_mesh.element_(element_index).jacobian_determinant_mutiply_weight_(column);
 }
 
+// NOTE: The connectivity only depends on the element type and the write position, so it is written once per buffer.
+template <typename ElementTrait, typename SimulationControl>
+inline void writeElementConnectivity(const ViewIndex<SimulationControl>& view_index,
+                                     ViewSupplemental<SimulationControl>& view_supplemental) {
+  constexpr std::array<int, ElementTrait::kVtkElementNumber> kVtkTypeNumber{
+      getElementVtkTypeNumber<ElementTrait::kElementType>()};
+  constexpr std::array<int, ElementTrait::kVtkElementNumber> kVtkPerNodeNumber{
+      getElementVtkPerNodeNumber<ElementTrait::kElementType, ElementTrait::kPolynomialOrder>()};
+  constexpr std::array<int, ElementTrait::kVtkAllNodeNumber> kVtkConnectivity{
+      getElementVTKConnectivity<ElementTrait::kElementType, ElementTrait::kPolynomialOrder>()};
+  for (Isize i = 0; i < ElementTrait::kVtkAllNodeNumber; i++) {
+    view_supplemental.element_connectivity_(view_index.vtk_node_index_ + i) =
+        kVtkConnectivity[static_cast<Usize>(i)] + view_index.node_index_;
+  }
+  Isize vtk_node_index = view_index.vtk_node_index_;
+  for (Isize i = 0; i < ElementTrait::kVtkElementNumber; i++) {
+    vtk_node_index += kVtkPerNodeNumber[static_cast<Usize>(i)];
+    view_supplemental.element_offset_(view_index.vtk_element_index_ + i) = vtk_node_index;
+    view_supplemental.element_type_(view_index.vtk_element_index_ + i) =
+        static_cast<vtu11::VtkCellType>(kVtkTypeNumber[static_cast<Usize>(i)]);
+  }
+}
+
 template <typename SimulationControl>
 template <typename AdjacencyElementTrait>
 inline void View<SimulationControl>::writeAdjacencyElement(
-    const Isize physical_index, const MeshInformation& information,
-    const AdjacencyElementMesh<AdjacencyElementTrait>& adjacency_element_mesh,
+    const Isize physical_index, const AdjacencyElementMesh<AdjacencyElementTrait>& adjacency_element_mesh,
     const PhysicalModel<SimulationControl>& physical_model, const ViewData<SimulationControl>& view_data,
-    const Isize element_index, ViewSupplemental<SimulationControl>& view_supplemental) {
+    const Eigen::Map<const Eigen::Vector<Real, Eigen::Dynamic>>& node_artificial_viscosity, const Isize element_index,
+    ViewIndex<SimulationControl>& view_index, ViewSupplemental<SimulationControl>& view_supplemental) {
   const AdjacencyElementViewSolver<AdjacencyElementTrait, SimulationControl>& adjacency_element_view_solver =
-      view_data.solver_.*(decltype(view_data.solver_)::template getAdjacencyElement<AdjacencyElementTrait>());
-  constexpr std::array<int, AdjacencyElementTrait::kVtkElementNumber> kVtkTypeNumber{
-      getElementVtkTypeNumber<AdjacencyElementTrait::kElementType>()};
-  constexpr std::array<int, AdjacencyElementTrait::kVtkElementNumber> kVtkPerNodeNumber{
-      getElementVtkPerNodeNumber<AdjacencyElementTrait::kElementType, AdjacencyElementTrait::kPolynomialOrder>()};
-  constexpr std::array<int, AdjacencyElementTrait::kAllNodeNumber> kVtkConnectivity{
-      getElementVTKConnectivity<AdjacencyElementTrait::kElementType, AdjacencyElementTrait::kPolynomialOrder>()};
-  const Isize adjacency_element_gmsh_tag =
-      information.physical_[static_cast<Usize>(physical_index)].element_gmsh_tag_[static_cast<Usize>(element_index)];
+      this->solver_.*(ViewSolver<SimulationControl>::template getAdjacencyElement<AdjacencyElementTrait>());
   const Isize adjacency_element_index_per_type =
-      information.gmsh_tag_to_element_physical_information_.at(adjacency_element_gmsh_tag).element_index_;
+      this->physical_element_index_[static_cast<Usize>(physical_index)][static_cast<Usize>(element_index)];
+  ViewVariable<AdjacencyElementTrait, SimulationControl> view_variable;
+  adjacency_element_view_solver.calcluateAdjacencyElementViewVariable(
+      adjacency_element_mesh, physical_model, this->solver_, node_artificial_viscosity, view_data.raw_binary_,
+      adjacency_element_index_per_type, view_variable);
+  if (!view_supplemental.is_geometry_valid_) {
+    for (Isize i = 0; i < AdjacencyElementTrait::kAllNodeNumber; i++) {
+      view_supplemental.node_coordinate_(Eigen::seqN(Eigen::fix<0>, Eigen::fix<SimulationControl::kDimension>),
+                                         view_index.node_index_ + i) =
+          adjacency_element_mesh.element_(adjacency_element_index_per_type).node_coordinate_(Eigen::all, i);
+    }
+    writeElementConnectivity<AdjacencyElementTrait>(view_index, view_supplemental);
+  }
   for (Isize i = 0; i < AdjacencyElementTrait::kAllNodeNumber; i++) {
-    view_supplemental.node_coordinate_(Eigen::seqN(Eigen::fix<0>, Eigen::fix<SimulationControl::kDimension>),
-                                       view_supplemental.node_index_ + i) =
-        adjacency_element_mesh.element_(adjacency_element_index_per_type).node_coordinate_(Eigen::all, i);
-    this->calculateViewVariable(physical_model,
-                                adjacency_element_view_solver.view_variable_(adjacency_element_index_per_type -
-                                                                             adjacency_element_mesh.interior_number_),
-                                view_supplemental.node_variable_, i, view_supplemental.node_index_ + i);
-    this->calculateAdjacencyForce(adjacency_element_mesh, physical_model,
-                                  adjacency_element_view_solver.view_variable_(adjacency_element_index_per_type -
-                                                                               adjacency_element_mesh.interior_number_),
-                                  view_supplemental.force_, adjacency_element_index_per_type, i);
-  }
-  for (Isize i = 0; i < AdjacencyElementTrait::kVtkAllNodeNumber; i++) {
-    view_supplemental.element_connectivity_(view_supplemental.vtk_node_index_ + i) =
-        kVtkConnectivity[static_cast<Usize>(i)] + view_supplemental.node_index_;
-  }
-  for (Usize i = 0; i < AdjacencyElementTrait::kVtkElementNumber; i++) {
-    view_supplemental.vtk_node_index_ += kVtkPerNodeNumber[i];
-    view_supplemental.element_offset_(view_supplemental.vtk_element_index_) = view_supplemental.vtk_node_index_;
-    view_supplemental.element_type_(view_supplemental.vtk_element_index_++) =
-        static_cast<vtu11::VtkCellType>(kVtkTypeNumber[i]);
-  }
-  view_supplemental.node_index_ += AdjacencyElementTrait::kAllNodeNumber;
+    this->calculateAdjacencyForce(adjacency_element_mesh, physical_model, view_variable, view_index.force_,
+                                  adjacency_element_index_per_type, i);
+  }
+  this->calculateViewVariable(physical_model, view_variable, view_supplemental.node_variable_, view_index.node_index_);
+  view_index.node_index_ += AdjacencyElementTrait::kAllNodeNumber;
+  view_index.vtk_node_index_ += AdjacencyElementTrait::kVtkAllNodeNumber;
+  view_index.vtk_element_index_ += AdjacencyElementTrait::kVtkElementNumber;
 }
 
 template <typename SimulationControl>
 template <typename ElementTrait>
-inline void View<SimulationControl>::writeElement(const Isize physical_index, const MeshInformation& information,
-                                                  const ElementMesh<ElementTrait>& element_mesh,
-                                                  const PhysicalModel<SimulationControl>& physical_model,
-                                                  const ViewData<SimulationControl>& view_data,
-                                                  const Isize element_index,
-                                                  ViewSupplemental<SimulationControl>& view_supplemental) {
+inline void View<SimulationControl>::writeElement(
+    const Isize physical_index, const ElementMesh<ElementTrait>& element_mesh,
+    const PhysicalModel<SimulationControl>& physical_model, const ViewData<SimulationControl>& view_data,
+    const Eigen::Map<const Eigen::Vector<Real, Eigen::Dynamic>>& node_artificial_viscosity, const Isize element_index,
+    ViewIndex<SimulationControl>& view_index, ViewSupplemental<SimulationControl>& view_supplemental) {
   const ElementViewSolver<ElementTrait, SimulationControl>& element_view_solver =
-      view_data.solver_.*(decltype(view_data.solver_)::template getElement<ElementTrait>());
-  constexpr std::array<int, ElementTrait::kVtkElementNumber> kVtkTypeNumber{
-      getElementVtkTypeNumber<ElementTrait::kElementType>()};
-  constexpr std::array<int, ElementTrait::kVtkElementNumber> kVtkPerNodeNumber{
-      getElementVtkPerNodeNumber<ElementTrait::kElementType, ElementTrait::kPolynomialOrder>()};
-  constexpr std::array<int, ElementTrait::kVtkAllNodeNumber> kVtkConnectivity{
-      getElementVTKConnectivity<ElementTrait::kElementType, ElementTrait::kPolynomialOrder>()};
-  const Isize element_gmsh_tag =
-      information.physical_[static_cast<Usize>(physical_index)].element_gmsh_tag_[static_cast<Usize>(element_index)];
+      this->solver_.*(ViewSolver<SimulationControl>::template getElement<ElementTrait>());
   const Isize element_index_per_type =
-      information.gmsh_tag_to_element_physical_information_.at(element_gmsh_tag).element_index_;
-  for (Isize i = 0; i < ElementTrait::kAllNodeNumber; i++) {
-    view_supplemental.node_coordinate_(Eigen::seqN(Eigen::fix<0>, Eigen::fix<SimulationControl::kDimension>),
-                                       view_supplemental.node_index_ + i) =
-        element_mesh.element_(element_index_per_type).node_coordinate_(Eigen::all, i);
-    this->calculateViewVariable(physical_model, element_view_solver.view_variable_(element_index_per_type),
-                                view_supplemental.node_variable_, i, view_supplemental.node_index_ + i);
+      this->physical_element_index_[static_cast<Usize>(physical_index)][static_cast<Usize>(element_index)];
+  ViewVariable<ElementTrait, SimulationControl> view_variable;
+  element_view_solver.calcluateElementViewVariable(element_mesh, physical_model, node_artificial_viscosity,
+                                                   view_data.raw_binary_, element_index_per_type, view_variable);
+  if (!view_supplemental.is_geometry_valid_) {
+    for (Isize i = 0; i < ElementTrait::kAllNodeNumber; i++) {
+      view_supplemental.node_coordinate_(Eigen::seqN(Eigen::fix<0>, Eigen::fix<SimulationControl::kDimension>),
+                                         view_index.node_index_ + i) =
+          element_mesh.element_(element_index_per_type).node_coordinate_(Eigen::all, i);
+    }
+    writeElementConnectivity<ElementTrait>(view_index, view_supplemental);
   }
-  for (Isize i = 0; i < ElementTrait::kVtkAllNodeNumber; i++) {
-    view_supplemental.element_connectivity_(view_supplemental.vtk_node_index_ + i) =
-        kVtkConnectivity[static_cast<Usize>(i)] + view_supplemental.node_index_;
+  this->calculateViewVariable(physical_model, view_variable, view_supplemental.node_variable_, view_index.node_index_);
+  view_index.node_index_ += ElementTrait::kAllNodeNumber;
+  view_index.vtk_node_index_ += ElementTrait::kVtkAllNodeNumber;
+  view_index.vtk_element_index_ += ElementTrait::kVtkElementNumber;
+}
+
+template <typename ElementTrait, typename SimulationControl>
+inline void addElementViewNumber(const Isize element_gmsh_type, ViewIndex<SimulationControl>& view_number) {
+  if (element_gmsh_type == ElementTrait::kGmshTypeNumber) {
+    view_number.node_index_ += ElementTrait::kAllNodeNumber;
+    view_number.vtk_node_index_ += ElementTrait::kVtkAllNodeNumber;
+    view_number.vtk_element_index_ += ElementTrait::kVtkElementNumber;
   }
-  for (Isize i = 0; i < ElementTrait::kVtkElementNumber; i++) {
-    view_supplemental.vtk_node_index_ += kVtkPerNodeNumber[static_cast<Usize>(i)];
-    view_supplemental.element_offset_(view_supplemental.vtk_element_index_) = view_supplemental.vtk_node_index_;
-    view_supplemental.element_type_(view_supplemental.vtk_element_index_++) =
-        static_cast<vtu11::VtkCellType>(kVtkTypeNumber[static_cast<Usize>(i)]);
+}
+
+template <typename SimulationControl>
+inline void addElementRangeViewNumber(const PhysicalInformation& physical, const Isize element_begin,
+                                      const Isize element_end, ViewIndex<SimulationControl>& view_number) {
+  for (Isize i = element_begin; i < element_end; i++) {
+    const Isize element_gmsh_type = physical.element_gmsh_type_[static_cast<Usize>(i)];
+    addElementViewNumber<LineTrait<SimulationControl::kPolynomialOrder>>(element_gmsh_type, view_number);
+    addElementViewNumber<TriangleTrait<SimulationControl::kPolynomialOrder>>(element_gmsh_type, view_number);
+    addElementViewNumber<QuadrangleTrait<SimulationControl::kPolynomialOrder>>(element_gmsh_type, view_number);
+    addElementViewNumber<TetrahedronTrait<SimulationControl::kPolynomialOrder>>(element_gmsh_type, view_number);
+    addElementViewNumber<PyramidTrait<SimulationControl::kPolynomialOrder>>(element_gmsh_type, view_number);
+    addElementViewNumber<HexahedronTrait<SimulationControl::kPolynomialOrder>>(element_gmsh_type, view_number);
   }
-  view_supplemental.node_index_ += ElementTrait::kAllNodeNumber;
 }
 
+// NOTE: The range is split into element chunks when the scheduler asks for it, the write position of each chunk is the
+// prefix sum of the sizes of the chunks before it, so the chunks fill the same arrays without any lock.
 template <typename SimulationControl>
 template <int Dimension, bool IsAdjacency>
 inline void View<SimulationControl>::writeField(const Isize physical_index, const Mesh<SimulationControl>& mesh,
                                                 const PhysicalModel<SimulationControl>& physical_model,
                                                 const ViewData<SimulationControl>& view_data,
+                                                const Isize element_begin, const Isize element_end,
                                                 ViewSupplemental<SimulationControl>& view_supplemental) {
-  const Isize element_number = mesh.information_.physical_[static_cast<Usize>(physical_index)].element_number_;
-  for (Isize i = 0; i < element_number; i++) {
-    const Isize element_gmsh_type =
-        mesh.information_.physical_[static_cast<Usize>(physical_index)].element_gmsh_type_[static_cast<Usize>(i)];
+  const Eigen::Map<const Eigen::Vector<Real, Eigen::Dynamic>> node_artificial_viscosity(
+      reinterpret_cast<const Real*>(view_data.raw_binary_.data() + view_data.raw_binary_block_.back().offset_),
+      mesh.node_number_);
+  const PhysicalInformation& physical = this->getViewPhysical(mesh.information_, physical_index);
+  const auto write_element = [&](const Isize i, ViewIndex<SimulationControl>& view_index) {
+    const Isize element_gmsh_type = physical.element_gmsh_type_[static_cast<Usize>(i)];
     if constexpr (Dimension == 1) {
       if constexpr (IsAdjacency) {
         this->writeAdjacencyElement<AdjacencyLineTrait<SimulationControl::kPolynomialOrder>>(
-            physical_index, mesh.information_, mesh.line_, physical_model, view_data, i, view_supplemental);
+            physical_index, mesh.line_, physical_model, view_data, node_artificial_viscosity, i, view_index,
+            view_supplemental);
       } else {
         this->writeElement<LineTrait<SimulationControl::kPolynomialOrder>>(
-            physical_index, mesh.information_, mesh.line_, physical_model, view_data, i, view_supplemental);
+            physical_index, mesh.line_, physical_model, view_data, node_artificial_viscosity, i, view_index,
+            view_supplemental);
       }
     } else if constexpr (Dimension == 2) {
       if constexpr (IsAdjacency) {
         if (element_gmsh_type == TriangleTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
           this->writeAdjacencyElement<AdjacencyTriangleTrait<SimulationControl::kPolynomialOrder>>(
-              physical_index, mesh.information_, mesh.triangle_, physical_model, view_data, i, view_supplemental);
+              physical_index, mesh.triangle_, physical_model, view_data, node_artificial_viscosity, i, view_index,
+              view_supplemental);
         } else if (element_gmsh_type == QuadrangleTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
           this->writeAdjacencyElement<AdjacencyQuadrangleTrait<SimulationControl::kPolynomialOrder>>(
-              physical_index, mesh.information_, mesh.quadrangle_, physical_model, view_data, i, view_supplemental);
+              physical_index, mesh.quadrangle_, physical_model, view_data, node_artificial_viscosity, i, view_index,
+              view_supplemental);
         }
       } else {
         if (element_gmsh_type == TriangleTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
           this->writeElement<TriangleTrait<SimulationControl::kPolynomialOrder>>(
-              physical_index, mesh.information_, mesh.triangle_, physical_model, view_data, i, view_supplemental);
+              physical_index, mesh.triangle_, physical_model, view_data, node_artificial_viscosity, i, view_index,
+              view_supplemental);
         } else if (element_gmsh_type == QuadrangleTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
           this->writeElement<QuadrangleTrait<SimulationControl::kPolynomialOrder>>(
-              physical_index, mesh.information_, mesh.quadrangle_, physical_model, view_data, i, view_supplemental);
+              physical_index, mesh.quadrangle_, physical_model, view_data, node_artificial_viscosity, i, view_index,
+              view_supplemental);
         }
       }
     } else if constexpr (Dimension == 3) {
       if (element_gmsh_type == TetrahedronTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
         this->writeElement<TetrahedronTrait<SimulationControl::kPolynomialOrder>>(
-            physical_index, mesh.information_, mesh.tetrahedron_, physical_model, view_data, i, view_supplemental);
+            physical_index, mesh.tetrahedron_, physical_model, view_data, node_artificial_viscosity, i, view_index,
+            view_supplemental);
       } else if (element_gmsh_type == PyramidTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
         this->writeElement<PyramidTrait<SimulationControl::kPolynomialOrder>>(
-            physical_index, mesh.information_, mesh.pyramid_, physical_model, view_data, i, view_supplemental);
+            physical_index, mesh.pyramid_, physical_model, view_data, node_artificial_viscosity, i, view_index,
+            view_supplemental);
       } else if (element_gmsh_type == HexahedronTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
         this->writeElement<HexahedronTrait<SimulationControl::kPolynomialOrder>>(
-            physical_index, mesh.information_, mesh.hexahedron_, physical_model, view_data, i, view_supplemental);
+            physical_index, mesh.hexahedron_, physical_model, view_data, node_artificial_viscosity, i, view_index,
+            view_supplemental);
       }
     }
+  };
+  const Isize chunk_number = std::ranges::max(
+      std::ranges::min(static_cast<Isize>(this->element_chunk_number_), element_end - element_begin), 1);
+  std::vector<ViewIndex<SimulationControl>> view_index(static_cast<Usize>(chunk_number));
+  if (chunk_number == 1) {
+    for (Isize i = element_begin; i < element_end; i++) {
+      write_element(i, view_index.front());
+    }
+  } else {
+    const auto get_chunk_begin = [&](const Isize chunk) {
+      return element_begin + (element_end - element_begin) * chunk / chunk_number;
+    };
+    tbb::parallel_for(0, chunk_number, [&](const Isize i) {
+      addElementRangeViewNumber(physical, get_chunk_begin(i), get_chunk_begin(i + 1),
+                                view_index[static_cast<Usize>(i)]);
+    });
+    ViewIndex<SimulationControl> view_number;
+    for (ViewIndex<SimulationControl>& chunk_view_index : view_index) {
+      const ViewIndex<SimulationControl> chunk_view_number = chunk_view_index;
+      chunk_view_index = view_number;
+      view_number.node_index_ += chunk_view_number.node_index_;
+      view_number.vtk_node_index_ += chunk_view_number.vtk_node_index_;
+      view_number.vtk_element_index_ += chunk_view_number.vtk_element_index_;
+    }
+    tbb::parallel_for(0, chunk_number, [&](const Isize i) {
+      for (Isize j = get_chunk_begin(i); j < get_chunk_begin(i + 1); j++) {
+        write_element(j, view_index[static_cast<Usize>(i)]);
+      }
+    });
+  }
+  for (const ViewIndex<SimulationControl>& chunk_view_index : view_index) {
+    view_supplemental.force_ += chunk_view_index.force_;
   }
 }
 
 template <typename SimulationControl>
-template <int Dimension, bool IsAdjacency>
-inline void View<SimulationControl>::writeView(const int step, const Isize physical_index,
-                                               const Mesh<SimulationControl>& mesh,
-                                               const PhysicalModel<SimulationControl>& physical_model,
-                                               const ViewData<SimulationControl>& view_data,
-                                               const std::string& base_name) {
-  ViewSupplemental<SimulationControl> view_supplemental(physical_index, mesh, this->variable_type_);
-  this->getDataSetInfomatoin(view_supplemental.data_set_information_);
-  this->writeField<Dimension, IsAdjacency>(physical_index, mesh, physical_model, view_data, view_supplemental);
+inline void View<SimulationControl>::writeViewFile(const int step,
+                                                   const Eigen::Vector<Real, SimulationControl::kDimension>& force,
+                                                   ViewSupplemental<SimulationControl>& view_supplemental,
+                                                   const std::filesystem::path& view_file_path) {
+  view_supplemental.data_set_data_[0].emplace_back(step);
+  view_supplemental.data_set_data_[1].emplace_back(this->time_value_(step));
+  Eigen::Vector<Real, 3> view_force{Eigen::Vector<Real, 3>::Zero()};
+  view_force(Eigen::seqN(Eigen::fix<0>, Eigen::fix<SimulationControl::kDimension>)) = force;
+  for (Isize i = 0; i < 3; i++) {
+    view_supplemental.data_set_data_[2].emplace_back(view_force(i));
+  }
+  for (Isize i = 0; i < static_cast<Isize>(this->variable_type_.size()); i++) {
+    view_supplemental.data_set_data_[static_cast<Usize>(i) + 3].assign(
+        view_supplemental.node_variable_(i).data(),
+        view_supplemental.node_variable_(i).data() + view_supplemental.node_variable_(i).size());
+  }
+  if (this->format_ == ViewFormatEnum::Xdmf) {
+    writeXdmfFieldFile(view_file_path, view_supplemental.data_set_data_);
+    return;
+  }
   vtu11::Vtu11UnstructuredMesh mesh_data{
       {view_supplemental.node_coordinate_.data(),
        view_supplemental.node_coordinate_.data() + view_supplemental.node_coordinate_.size()},
@@ -261,30 +541,139 @@ inline void View<SimulationControl>::writeView(const int step, const Isize physi
        view_supplemental.element_offset_.data() + view_supplemental.element_offset_.size()},
       {view_supplemental.element_type_.data(),
        view_supplemental.element_type_.data() + view_supplemental.element_type_.size()}};
-  view_supplemental.data_set_data_[0].emplace_back(step);
-  view_supplemental.data_set_data_[1].emplace_back(this->time_value_(step));
-  Eigen::Vector<Real, 3> force{Eigen::Vector<Real, 3>::Zero()};
-  force(Eigen::seqN(Eigen::fix<0>, Eigen::fix<SimulationControl::kDimension>)) = view_supplemental.force_;
-  for (Isize i = 0; i < 3; i++) {
-    view_supplemental.data_set_data_[2].emplace_back(force(i));
+  writeVtuFile(view_file_path.string(), mesh_data, this->data_set_information_, view_supplemental.data_set_data_,
+               this->write_mode_, this->compression_level_);
+}
+
+// NOTE: The .pvtu file only repeats the point data layout and lists the pieces, the field data is read from the pieces.
+template <typename SimulationControl>
+inline void View<SimulationControl>::writePartitionIndex(const std::string& base_name, const Isize partition_number) {
+  const std::string piece_name = std::filesystem::path(base_name).stem().string();
+  std::fstream index_fout(this->getViewDirectory() / base_name, std::ios::out | std::ios::trunc);
+  index_fout << "<?xml version=\"1.0\"?>\n";
+  index_fout << "<VTKFile type=\"PUnstructuredGrid\" version=\"0.1\" byte_order=\"LittleEndian\">\n";
+  index_fout << "  <PUnstructuredGrid GhostLevel=\"0\">\n";
+  index_fout << "    <PPointData>\n";
+  for (const auto& [name, type, component_number, tuple_number] : this->data_set_information_) {
+    if (type == vtu11::DataSetType::PointData) {
+      index_fout << std::format("      <PDataArray type=\"Float64\" Name=\"{}\" NumberOfComponents=\"{}\"/>\n", name,
+                                component_number);
+    }
   }
-  for (Isize i = 0; i < static_cast<Isize>(this->variable_type_.size()); i++) {
-    view_supplemental.data_set_data_[static_cast<Usize>(i) + 3].assign(
-        view_supplemental.node_variable_(i).data(),
-        view_supplemental.node_variable_(i).data() + view_supplemental.node_variable_(i).size());
+  index_fout << "    </PPointData>\n";
+  index_fout << "    <PPoints>\n";
+  index_fout << "      <PDataArray type=\"Float64\" NumberOfComponents=\"3\"/>\n";
+  index_fout << "    </PPoints>\n";
+  for (Isize i = 0; i < partition_number; i++) {
+    index_fout << std::format("    <Piece Source=\"{}/{}_{}.vtu\"/>\n", piece_name, piece_name, i);
+  }
+  index_fout << "  </PUnstructuredGrid>\n";
+  index_fout << "</VTKFile>\n";
+  index_fout.close();
+}
+
+// NOTE: The first snapshot that writes a physical group also writes its mesh file, later snapshots only write the field
+// file and the descriptor points all of them at the same mesh.
+template <typename SimulationControl>
+inline void View<SimulationControl>::writeXdmfMesh(const Isize physical_index, const PhysicalInformation& physical,
+                                                   const ViewSupplemental<SimulationControl>& view_supplemental) {
+  std::lock_guard<std::mutex> lock(this->xdmf_mutex_);
+  XdmfTopologyNumber& topology_number = this->xdmf_topology_number_[static_cast<Usize>(physical_index)];
+  if (topology_number.topology_number_ == 0) {
+    topology_number = writeXdmfMeshFile(
+        this->getViewDirectory() / this->getXdmfMeshFileName(physical.name_), view_supplemental.node_coordinate_,
+        view_supplemental.element_connectivity_, view_supplemental.element_offset_, view_supplemental.element_type_,
+        this->xdmf_sub_cell_);
+  }
+}
+
+template <typename SimulationControl>
+inline void View<SimulationControl>::writeXdmfPhysicalCollection(const Isize physical_index,
+                                                                 const PhysicalInformation& physical,
+                                                                 const int io_interval, const int iteration_start,
+                                                                 const int iteration_end) {
+  std::vector<std::pair<Real, std::string>> step_information;
+  for (int i = iteration_start; i <= iteration_end; i++) {
+    if (i % io_interval == 0 &&
+        std::filesystem::exists(this->getViewDirectory() / this->getBaseName(i, physical.name_))) {
+      step_information.emplace_back(this->time_value_(i), this->getBaseName(i, physical.name_));
+    }
+  }
+  const std::filesystem::path collection_file_path =
+      this->getViewDirectory() / std::format("{}_{}.xdmf", this->output_file_name_prefix_, physical.name_);
+  // NOTE: When every step was already up to date the mesh file comes from an earlier view and its topology size and
+  // sub-cell number are read back from the file.
+  XdmfTopologyNumber& topology_number = this->xdmf_topology_number_[static_cast<Usize>(physical_index)];
+  const std::filesystem::path mesh_file_path = this->getViewDirectory() / this->getXdmfMeshFileName(physical.name_);
+  if (topology_number.topology_number_ == 0 && std::filesystem::exists(mesh_file_path)) {
+    topology_number = readXdmfMeshFile(mesh_file_path, physical.node_number_);
+  }
+  writeXdmfCollection(collection_file_path,
+                      {.mesh_file_name_ = this->getXdmfMeshFileName(physical.name_),
+                       .node_number_ = physical.node_number_,
+                       .element_number_ = topology_number.element_number_,
+                       .topology_number_ = topology_number.topology_number_},
+                      this->data_set_information_, step_information);
+}
+
+// NOTE: Each piece holds a contiguous range of the physical group and is built and written by its own task, the force
+// is summed over all pieces before any of them is written.
+template <typename SimulationControl>
+template <int Dimension, bool IsAdjacency>
+inline void View<SimulationControl>::writeView(const int step, const Isize physical_index,
+                                               const Mesh<SimulationControl>& mesh,
+                                               const PhysicalModel<SimulationControl>& physical_model,
+                                               ViewData<SimulationControl>& view_data, const std::string& base_name) {
+  const PhysicalInformation& physical = this->getViewPhysical(mesh.information_, physical_index);
+  std::vector<ViewSupplemental<SimulationControl>>& view_supplemental =
+      view_data.view_supplemental_[static_cast<Usize>(physical_index)];
+  if (this->partition_number_ <= 1 || this->format_ == ViewFormatEnum::Xdmf) {
+    view_supplemental.resize(1);
+    view_supplemental.front().resize(0, physical.element_number_, physical.node_number_, physical.vtk_node_number_,
+                                     physical.vtk_element_number_, this->variable_type_);
+    this->writeField<Dimension, IsAdjacency>(physical_index, mesh, physical_model, view_data, 0,
+                                             physical.element_number_, view_supplemental.front());
+    if (this->format_ == ViewFormatEnum::Xdmf) {
+      this->writeXdmfMesh(physical_index, physical, view_supplemental.front());
+    }
+    this->writeViewFile(step, view_supplemental.front().force_, view_supplemental.front(),
+                        this->getViewDirectory() / base_name);
+    return;
+  }
+  const Isize partition_number =
+      std::ranges::max(std::ranges::min(static_cast<Isize>(this->partition_number_), physical.element_number_), 1);
+  view_supplemental.resize(static_cast<Usize>(partition_number));
+  tbb::parallel_for(0, partition_number, [&](const Isize i) {
+    const Isize element_begin = physical.element_number_ * i / partition_number;
+    const Isize element_end = physical.element_number_ * (i + 1) / partition_number;
+    ViewIndex<SimulationControl> view_number;
+    addElementRangeViewNumber(physical, element_begin, element_end, view_number);
+    view_supplemental[static_cast<Usize>(i)].resize(element_begin, element_end, view_number.node_index_,
+                                                    view_number.vtk_node_index_, view_number.vtk_element_index_,
+                                                    this->variable_type_);
+    this->writeField<Dimension, IsAdjacency>(physical_index, mesh, physical_model, view_data, element_begin,
+                                             element_end, view_supplemental[static_cast<Usize>(i)]);
+  });
+  Eigen::Vector<Real, SimulationControl::kDimension> force{Eigen::Vector<Real, SimulationControl::kDimension>::Zero()};
+  for (const ViewSupplemental<SimulationControl>& piece_view_supplemental : view_supplemental) {
+    force += piece_view_supplemental.force_;
   }
-  vtu11::writeVtu((this->output_directory_ / "vtu" / base_name).string(), mesh_data,
-                  view_supplemental.data_set_information_, view_supplemental.data_set_data_, "rawbinarycompressed");
+  const std::string piece_name = std::filesystem::path(base_name).stem().string();
+  std::filesystem::create_directories(this->getViewDirectory() / piece_name);
+  tbb::parallel_for(0, partition_number, [&](const Isize i) {
+    this->writeViewFile(step, force, view_supplemental[static_cast<Usize>(i)],
+                        this->getViewDirectory() / piece_name / std::format("{}_{}.vtu", piece_name, i));
+  });
+  this->writePartitionIndex(base_name, partition_number);
 }
 
 template <typename SimulationControl>
 inline void View<SimulationControl>::stepView(const int step, const Mesh<SimulationControl>& mesh,
                                               const PhysicalModel<SimulationControl>& physical_model,
                                               ViewData<SimulationControl>& view_data) {
-  view_data.solver_.calcluateViewVariable(mesh, physical_model, view_data.raw_binary_path_, view_data.raw_binary_ss_);
+  view_data.view_supplemental_.resize(static_cast<Usize>(mesh.information_.physical_number_));
   for (Isize i = 0; i < mesh.information_.physical_number_; i++) {
-    if ((mesh.information_.physical_[static_cast<Usize>(i)].dimension_ == SimulationControl::kDimension - 1) &&
-        !isWall(mesh.information_.physical_[static_cast<Usize>(i)].boundary_condition_type_)) {
+    if (!this->isViewPhysical(mesh.information_.physical_[static_cast<Usize>(i)])) {
       continue;
     }
     const std::string base_name = this->getBaseName(step, mesh.information_.physical_[static_cast<Usize>(i)].name_);
@@ -308,6 +697,18 @@ inline void View<SimulationControl>::stepView(const int step, const Mesh<Simulat
   }
 }
 
+template <typename SimulationControl>
+inline void View<SimulationControl>::stepSubsetView(const int step, const Isize subset_index,
+                                                    const Mesh<SimulationControl>& mesh,
+                                                    const PhysicalModel<SimulationControl>& physical_model,
+                                                    ViewData<SimulationControl>& view_data) {
+  const Isize physical_index = mesh.information_.physical_number_ + subset_index;
+  view_data.view_supplemental_.resize(static_cast<Usize>(physical_index) + 1);
+  this->writeView<SimulationControl::kDimension, false>(
+      step, physical_index, mesh, physical_model, view_data,
+      this->getBaseName(step, this->subset_physical_[static_cast<Usize>(subset_index)].name_));
+}
+
 }  // namespace SubrosaDG
 
 #endif  // SUBROSA_DG_PARAVIEW_CPP_
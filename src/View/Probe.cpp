@@ -0,0 +1,622 @@
+/**
+ * @file Probe.cpp
+ * @brief The header file of SubrosaDG point probe.
+ *
+ * @author Yufei.Liu, Calm.Liu@outlook.com | Chenyu.Bao, bcynuaa@163.com
+ * @date 2025-04-14
+ *
+ * @version 0.1.0
+ * @copyright Copyright (c) 2022 - 2025 by SubrosaDG developers. All rights reserved.
+ * SubrosaDG is free software and is distributed under the MIT license.
+ */
+
+#ifndef SUBROSA_DG_PROBE_CPP_
+#define SUBROSA_DG_PROBE_CPP_
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <ios>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Mesh/BasisFunction.cpp"
+#include "Mesh/ReadControl.cpp"
+#include "Solver/PhysicalModel.cpp"
+#include "Solver/SimulationControl.cpp"
+#include "Solver/SolveControl.cpp"
+#include "Solver/VariableConvertor.cpp"
+#include "Utils/BasicDataType.cpp"
+#include "Utils/Enum.cpp"
+
+namespace SubrosaDG {
+
+inline constexpr std::array<char, 8> kProbeMagic{'S', 'D', 'G', 'P', 'R', 'O', 'B', 'E'};
+inline constexpr std::uint32_t kProbeVersion{1};
+inline constexpr Isize kProbeLeafSize{8};
+inline constexpr int kProbeNewtonIteration{20};
+inline constexpr Real kProbeTolerance{1e-6_r};
+
+template <int Dimension>
+struct ProbeBoundingBox {
+  Eigen::Vector<Real, Dimension> minimum_;
+  Eigen::Vector<Real, Dimension> maximum_;
+  int gmsh_type_{-1};
+  Isize element_index_{-1};
+
+  [[nodiscard]] inline bool isInside(const Eigen::Vector<Real, Dimension>& coordinate) const {
+    return (coordinate.array() >= this->minimum_.array()).all() && (coordinate.array() <= this->maximum_.array()).all();
+  }
+};
+
+// NOTE: The hierarchy is stored flat, the boxes of a node are the range [begin, end) of the sorted element boxes and a
+// node without children is a leaf. It is built once at setup, so a median split on the longest axis is enough.
+template <int Dimension>
+struct ProbeBoundingVolumeHierarchy {
+  struct Node {
+    ProbeBoundingBox<Dimension> bounding_box_;
+    Isize begin_;
+    Isize end_;
+    Isize left_{-1};
+    Isize right_{-1};
+  };
+
+  std::vector<ProbeBoundingBox<Dimension>> element_bounding_box_;
+  std::vector<Node> node_;
+
+  inline Isize buildNode(const Isize begin, const Isize end) {
+    const auto node_index = static_cast<Isize>(this->node_.size());
+    Node& node = this->node_.emplace_back();
+    node.begin_ = begin;
+    node.end_ = end;
+    node.bounding_box_.minimum_ = this->element_bounding_box_[static_cast<Usize>(begin)].minimum_;
+    node.bounding_box_.maximum_ = this->element_bounding_box_[static_cast<Usize>(begin)].maximum_;
+    for (Isize i = begin + 1; i < end; i++) {
+      node.bounding_box_.minimum_ =
+          node.bounding_box_.minimum_.cwiseMin(this->element_bounding_box_[static_cast<Usize>(i)].minimum_);
+      node.bounding_box_.maximum_ =
+          node.bounding_box_.maximum_.cwiseMax(this->element_bounding_box_[static_cast<Usize>(i)].maximum_);
+    }
+    if (end - begin <= kProbeLeafSize) {
+      return node_index;
+    }
+    Isize axis;
+    (node.bounding_box_.maximum_ - node.bounding_box_.minimum_).maxCoeff(&axis);
+    const Isize middle = begin + (end - begin) / 2;
+    std::nth_element(this->element_bounding_box_.begin() + begin, this->element_bounding_box_.begin() + middle,
+                     this->element_bounding_box_.begin() + end,
+                     [axis](const ProbeBoundingBox<Dimension>& left, const ProbeBoundingBox<Dimension>& right) {
+                       return left.minimum_(axis) + left.maximum_(axis) < right.minimum_(axis) + right.maximum_(axis);
+                     });
+    const Isize left = this->buildNode(begin, middle);
+    const Isize right = this->buildNode(middle, end);
+    this->node_[static_cast<Usize>(node_index)].left_ = left;
+    this->node_[static_cast<Usize>(node_index)].right_ = right;
+    return node_index;
+  }
+
+  template <typename ElementTrait>
+  inline void addElementBoundingBox(const ElementMesh<ElementTrait>& element_mesh) {
+    for (Isize i = 0; i < element_mesh.number_; i++) {
+      ProbeBoundingBox<Dimension>& bounding_box = this->element_bounding_box_.emplace_back();
+      bounding_box.minimum_ = element_mesh.element_(i).node_coordinate_.rowwise().minCoeff();
+      bounding_box.maximum_ = element_mesh.element_(i).node_coordinate_.rowwise().maxCoeff();
+      const Eigen::Vector<Real, Dimension> padding = Eigen::Vector<Real, Dimension>::Constant(
+          kProbeTolerance * (bounding_box.maximum_ - bounding_box.minimum_).maxCoeff());
+      bounding_box.minimum_ -= padding;
+      bounding_box.maximum_ += padding;
+      bounding_box.gmsh_type_ = ElementTrait::kGmshTypeNumber;
+      bounding_box.element_index_ = i;
+    }
+  }
+
+  template <typename SimulationControl>
+  inline void build(const Mesh<SimulationControl>& mesh) {
+    this->element_bounding_box_.clear();
+    this->node_.clear();
+    if constexpr (SimulationControl::kDimension == 1) {
+      this->addElementBoundingBox(mesh.line_);
+    } else if constexpr (SimulationControl::kDimension == 2) {
+      this->addElementBoundingBox(mesh.triangle_);
+      this->addElementBoundingBox(mesh.quadrangle_);
+    } else if constexpr (SimulationControl::kDimension == 3) {
+      this->addElementBoundingBox(mesh.tetrahedron_);
+      this->addElementBoundingBox(mesh.pyramid_);
+      this->addElementBoundingBox(mesh.hexahedron_);
+    }
+    if (!this->element_bounding_box_.empty()) {
+      this->buildNode(0, static_cast<Isize>(this->element_bounding_box_.size()));
+    }
+  }
+
+  // NOTE: Visits every element box that holds the coordinate until the function accepts one of them.
+  inline bool find(const Eigen::Vector<Real, Dimension>& coordinate,
+                   const std::function<bool(const ProbeBoundingBox<Dimension>&)>& function) const {
+    if (this->node_.empty()) {
+      return false;
+    }
+    std::vector<Isize> stack{0};
+    while (!stack.empty()) {
+      const Node& node = this->node_[static_cast<Usize>(stack.back())];
+      stack.pop_back();
+      if (!node.bounding_box_.isInside(coordinate)) {
+        continue;
+      }
+      if (node.left_ < 0) {
+        for (Isize i = node.begin_; i < node.end_; i++) {
+          const ProbeBoundingBox<Dimension>& bounding_box = this->element_bounding_box_[static_cast<Usize>(i)];
+          if (bounding_box.isInside(coordinate) && function(bounding_box)) {
+            return true;
+          }
+        }
+      } else {
+        stack.emplace_back(node.left_);
+        stack.emplace_back(node.right_);
+      }
+    }
+    return false;
+  }
+
+  // NOTE: Branch and bound on the distance to the boxes, it returns the element box nearest to a coordinate which lies
+  // outside every element, e.g. on a curved boundary that two meshes discretize differently.
+  [[nodiscard]] inline const ProbeBoundingBox<Dimension>& findNearest(
+      const Eigen::Vector<Real, Dimension>& coordinate) const {
+    const auto distance = [&coordinate](const ProbeBoundingBox<Dimension>& bounding_box) {
+      return (coordinate.cwiseMax(bounding_box.minimum_).cwiseMin(bounding_box.maximum_) - coordinate).squaredNorm();
+    };
+    Real nearest_distance = std::numeric_limits<Real>::max();
+    Isize nearest_index = 0;
+    std::vector<Isize> stack{0};
+    while (!stack.empty()) {
+      const Node& node = this->node_[static_cast<Usize>(stack.back())];
+      stack.pop_back();
+      if (distance(node.bounding_box_) >= nearest_distance) {
+        continue;
+      }
+      if (node.left_ < 0) {
+        for (Isize i = node.begin_; i < node.end_; i++) {
+          const Real element_distance = distance(this->element_bounding_box_[static_cast<Usize>(i)]);
+          if (element_distance < nearest_distance) {
+            nearest_distance = element_distance;
+            nearest_index = i;
+          }
+        }
+      } else {
+        stack.emplace_back(node.left_);
+        stack.emplace_back(node.right_);
+      }
+    }
+    return this->element_bounding_box_[static_cast<Usize>(nearest_index)];
+  }
+};
+
+template <ElementEnum ElementType>
+inline bool isInsideReferenceElement(const Eigen::Vector<Real, 3>& local_coord) {
+  const Real x = local_coord(0);
+  const Real y = local_coord(1);
+  const Real z = local_coord(2);
+  if constexpr (ElementType == ElementEnum::Line) {
+    return std::abs(x) <= 1.0_r + kProbeTolerance;
+  }
+  if constexpr (ElementType == ElementEnum::Triangle) {
+    return x >= -kProbeTolerance && y >= -kProbeTolerance && x + y <= 1.0_r + kProbeTolerance;
+  }
+  if constexpr (ElementType == ElementEnum::Quadrangle) {
+    return std::abs(x) <= 1.0_r + kProbeTolerance && std::abs(y) <= 1.0_r + kProbeTolerance;
+  }
+  if constexpr (ElementType == ElementEnum::Tetrahedron) {
+    return x >= -kProbeTolerance && y >= -kProbeTolerance && z >= -kProbeTolerance &&
+           x + y + z <= 1.0_r + kProbeTolerance;
+  }
+  if constexpr (ElementType == ElementEnum::Pyramid) {
+    return z >= -kProbeTolerance && z <= 1.0_r + kProbeTolerance && std::abs(x) <= 1.0_r - z + kProbeTolerance &&
+           std::abs(y) <= 1.0_r - z + kProbeTolerance;
+  }
+  if constexpr (ElementType == ElementEnum::Hexahedron) {
+    return std::abs(x) <= 1.0_r + kProbeTolerance && std::abs(y) <= 1.0_r + kProbeTolerance &&
+           std::abs(z) <= 1.0_r + kProbeTolerance;
+  }
+  return false;
+}
+
+// NOTE: The nodal and modal bases of an element span the polynomials of its order, for the pyramid they span the
+// rational space of Bergot with a power of 1 - z as denominator. Both are expanded in the monomials of that space, the
+// coefficients are the inverse of the Vandermonde matrix at the reference nodes times the bases at the nodes. Gmsh is
+// only called here at setup since it is not thread safe, the point search then evaluates the monomials on its own.
+template <typename ElementTrait>
+struct ElementProbeBasisFunction {
+  std::array<std::array<int, 4>, ElementTrait::kAllNodeNumber> exponent_;
+  Eigen::Matrix<Real, ElementTrait::kAllNodeNumber, ElementTrait::kAllNodeNumber> nodal_coefficient_;
+  Eigen::Matrix<Real, ElementTrait::kBasisFunctionNumber, ElementTrait::kAllNodeNumber> modal_coefficient_;
+  Eigen::Vector<Real, ElementTrait::kDimension> reference_centroid_;
+
+  inline void initializeExponent() {
+    constexpr int kPolynomialOrder{ElementTrait::kPolynomialOrder};
+    Usize index = 0;
+    for (int k = 0; k <= (ElementTrait::kDimension == 3 ? kPolynomialOrder : 0); k++) {
+      for (int j = 0; j <= (ElementTrait::kDimension >= 2 ? kPolynomialOrder : 0); j++) {
+        for (int i = 0; i <= kPolynomialOrder; i++) {
+          if constexpr (ElementTrait::kElementType == ElementEnum::Triangle) {
+            if (i + j > kPolynomialOrder) {
+              continue;
+            }
+          } else if constexpr (ElementTrait::kElementType == ElementEnum::Tetrahedron) {
+            if (i + j + k > kPolynomialOrder) {
+              continue;
+            }
+          } else if constexpr (ElementTrait::kElementType == ElementEnum::Pyramid) {
+            if (k > kPolynomialOrder - std::max(i, j)) {
+              continue;
+            }
+          }
+          this->exponent_[index++] = {i, j, k, ElementTrait::kElementType == ElementEnum::Pyramid ? std::min(i, j) : 0};
+        }
+      }
+    }
+  }
+
+  template <typename Scalar>
+  inline void getMonomial(
+      const Eigen::Vector<Scalar, ElementTrait::kDimension>& local_coord,
+      Eigen::Vector<Scalar, ElementTrait::kAllNodeNumber>& value,
+      Eigen::Matrix<Scalar, ElementTrait::kAllNodeNumber, ElementTrait::kDimension>& gradient) const {
+    constexpr int kPolynomialOrder{ElementTrait::kPolynomialOrder};
+    std::array<std::array<Scalar, kPolynomialOrder + 1>, 3> power{};
+    for (Isize i = 0; i < 3; i++) {
+      power[static_cast<Usize>(i)][0] = Scalar{1};
+      for (int j = 1; j <= kPolynomialOrder; j++) {
+        power[static_cast<Usize>(i)][static_cast<Usize>(j)] =
+            i < ElementTrait::kDimension ? power[static_cast<Usize>(i)][static_cast<Usize>(j - 1)] * local_coord(i)
+                                         : Scalar{0};
+      }
+    }
+    // NOTE: The denominator of the pyramid vanishes at the apex, where the rational monomials tend to zero inside the
+    // element, so it is bounded by the tolerance of the probe.
+    std::array<Scalar, kPolynomialOrder + 2> denominator_power{};
+    denominator_power[0] = Scalar{1};
+    if constexpr (ElementTrait::kElementType == ElementEnum::Pyramid) {
+      const Scalar inverse_denominator =
+          Scalar{1} / std::max(Scalar{1} - local_coord(2), static_cast<Scalar>(kProbeTolerance));
+      for (Usize i = 1; i < denominator_power.size(); i++) {
+        denominator_power[i] = denominator_power[i - 1] * inverse_denominator;
+      }
+    }
+    for (Isize i = 0; i < ElementTrait::kAllNodeNumber; i++) {
+      const std::array<int, 4>& exponent = this->exponent_[static_cast<Usize>(i)];
+      const auto get_power = [&](const Isize direction, const int order) {
+        return order < 0 ? Scalar{0} : power[static_cast<Usize>(direction)][static_cast<Usize>(order)];
+      };
+      const Scalar denominator = denominator_power[static_cast<Usize>(exponent[3])];
+      value(i) = get_power(0, exponent[0]) * get_power(1, exponent[1]) * get_power(2, exponent[2]) * denominator;
+      for (Isize j = 0; j < ElementTrait::kDimension; j++) {
+        Scalar derivative = static_cast<Scalar>(exponent[static_cast<Usize>(j)]) * denominator;
+        for (Isize k = 0; k < 3; k++) {
+          derivative *= get_power(k, exponent[static_cast<Usize>(k)] - (k == j ? 1 : 0));
+        }
+        gradient(i, j) = derivative;
+      }
+      if constexpr (ElementTrait::kElementType == ElementEnum::Pyramid) {
+        gradient(i, 2) += static_cast<Scalar>(exponent[3]) * get_power(0, exponent[0]) * get_power(1, exponent[1]) *
+                          get_power(2, exponent[2]) * denominator_power[static_cast<Usize>(exponent[3] + 1)];
+      }
+    }
+  }
+
+  inline void initializeElementProbeBasisFunction() {
+    this->initializeExponent();
+    const std::vector<double> node_coordinate{
+        getElementNodeCoordinate<ElementTrait::kElementType, ElementTrait::kPolynomialOrder>()};
+    const Eigen::Map<const Eigen::Matrix<double, ElementTrait::kDimension, ElementTrait::kAllNodeNumber>>
+        reference_node_coordinate(node_coordinate.data());
+    Eigen::Matrix<double, ElementTrait::kAllNodeNumber, ElementTrait::kAllNodeNumber> vandermonde;
+    Eigen::Vector<double, ElementTrait::kAllNodeNumber> value;
+    Eigen::Matrix<double, ElementTrait::kAllNodeNumber, ElementTrait::kDimension> gradient;
+    Eigen::Matrix<double, 3, ElementTrait::kAllNodeNumber> local_coord{
+        Eigen::Matrix<double, 3, ElementTrait::kAllNodeNumber>::Zero()};
+    for (Isize i = 0; i < ElementTrait::kAllNodeNumber; i++) {
+      this->template getMonomial<double>(reference_node_coordinate.col(i), value, gradient);
+      vandermonde.col(i) = value;
+      local_coord(Eigen::seqN(Eigen::fix<0>, Eigen::fix<ElementTrait::kDimension>), i) =
+          reference_node_coordinate.col(i);
+    }
+    const std::vector<double> modal_basis_functions{
+        getElementModalBasisFunction<ElementTrait::kElementType, ElementTrait::kPolynomialOrder>(
+            false, {local_coord.data(), local_coord.data() + local_coord.size()})};
+    const Eigen::Map<const Eigen::Matrix<double, ElementTrait::kBasisFunctionNumber, ElementTrait::kAllNodeNumber>>
+        modal_node_value(modal_basis_functions.data());
+    const Eigen::Matrix<double, ElementTrait::kAllNodeNumber, ElementTrait::kAllNodeNumber> vandermonde_inverse =
+        vandermonde.inverse();
+    this->nodal_coefficient_ = vandermonde_inverse.template cast<Real>();
+    this->modal_coefficient_ = (modal_node_value * vandermonde_inverse).template cast<Real>();
+    this->reference_centroid_ =
+        reference_node_coordinate(Eigen::all, Eigen::seqN(Eigen::fix<0>, Eigen::fix<ElementTrait::kBasicNodeNumber>))
+            .rowwise()
+            .mean()
+            .template cast<Real>();
+  }
+};
+
+template <typename SimulationControl, int Dimension>
+struct ProbeBasisFunctionData;
+
+template <typename SimulationControl>
+struct ProbeBasisFunctionData<SimulationControl, 1> {
+  ElementProbeBasisFunction<LineTrait<SimulationControl::kPolynomialOrder>> line_;
+};
+
+template <typename SimulationControl>
+struct ProbeBasisFunctionData<SimulationControl, 2> {
+  ElementProbeBasisFunction<TriangleTrait<SimulationControl::kPolynomialOrder>> triangle_;
+  ElementProbeBasisFunction<QuadrangleTrait<SimulationControl::kPolynomialOrder>> quadrangle_;
+};
+
+template <typename SimulationControl>
+struct ProbeBasisFunctionData<SimulationControl, 3> {
+  ElementProbeBasisFunction<TetrahedronTrait<SimulationControl::kPolynomialOrder>> tetrahedron_;
+  ElementProbeBasisFunction<PyramidTrait<SimulationControl::kPolynomialOrder>> pyramid_;
+  ElementProbeBasisFunction<HexahedronTrait<SimulationControl::kPolynomialOrder>> hexahedron_;
+};
+
+template <typename SimulationControl>
+struct ProbeBasisFunction : ProbeBasisFunctionData<SimulationControl, SimulationControl::kDimension> {
+  inline void initializeProbeBasisFunction() {
+    if constexpr (SimulationControl::kDimension == 1) {
+      this->line_.initializeElementProbeBasisFunction();
+    } else if constexpr (SimulationControl::kDimension == 2) {
+      this->triangle_.initializeElementProbeBasisFunction();
+      this->quadrangle_.initializeElementProbeBasisFunction();
+    } else if constexpr (SimulationControl::kDimension == 3) {
+      this->tetrahedron_.initializeElementProbeBasisFunction();
+      this->pyramid_.initializeElementProbeBasisFunction();
+      this->hexahedron_.initializeElementProbeBasisFunction();
+    }
+  }
+};
+
+// NOTE: The element geometry is the Lagrange map of all its nodes, the same map the solver uses, so the reference
+// coordinate is found with a Newton iteration started from the reference centroid. The iteration stops once the
+// distance to the probe is below the tolerance scaled by the element size. The modal basis functions are then evaluated
+// once at that point, an extrapolated point skips the check of the reference element. The modal value is resized only
+// on its first use, so a caller that reuses it does not allocate.
+template <typename ElementTrait>
+inline bool locateElementProbe(const ElementMesh<ElementTrait>& element_mesh,
+                               const ElementProbeBasisFunction<ElementTrait>& probe_basis_function,
+                               const Isize element_index,
+                               const Eigen::Vector<Real, ElementTrait::kDimension>& coordinate,
+                               Eigen::Vector<Real, Eigen::Dynamic>& modal_value, const bool is_extrapolated = false) {
+  const Eigen::Matrix<Real, ElementTrait::kDimension, ElementTrait::kAllNodeNumber>& node_coordinate =
+      element_mesh.element_(element_index).node_coordinate_;
+  const Eigen::Matrix<Real, ElementTrait::kDimension, ElementTrait::kAllNodeNumber> geometry_coefficient =
+      node_coordinate * probe_basis_function.nodal_coefficient_;
+  const Real tolerance =
+      kProbeTolerance * (node_coordinate.rowwise().maxCoeff() - node_coordinate.rowwise().minCoeff()).norm();
+  Eigen::Vector<Real, ElementTrait::kDimension> local_coord = probe_basis_function.reference_centroid_;
+  Eigen::Vector<Real, ElementTrait::kAllNodeNumber> monomial_value;
+  Eigen::Matrix<Real, ElementTrait::kAllNodeNumber, ElementTrait::kDimension> monomial_gradient;
+  for (int i = 0; i < kProbeNewtonIteration; i++) {
+    probe_basis_function.getMonomial(local_coord, monomial_value, monomial_gradient);
+    const Eigen::Vector<Real, ElementTrait::kDimension> residual = geometry_coefficient * monomial_value - coordinate;
+    if (residual.norm() < tolerance) {
+      break;
+    }
+    const Eigen::Matrix<Real, ElementTrait::kDimension, ElementTrait::kDimension> jacobian =
+        geometry_coefficient * monomial_gradient;
+    local_coord -= jacobian.inverse() * residual;
+  }
+  Eigen::Vector<Real, 3> reference_coord{Eigen::Vector<Real, 3>::Zero()};
+  reference_coord(Eigen::seqN(Eigen::fix<0>, Eigen::fix<ElementTrait::kDimension>)) = local_coord;
+  if (!is_extrapolated && !isInsideReferenceElement<ElementTrait::kElementType>(reference_coord)) {
+    return false;
+  }
+  probe_basis_function.getMonomial(local_coord, monomial_value, monomial_gradient);
+  modal_value.resize(ElementTrait::kBasisFunctionNumber);
+  modal_value.noalias() = probe_basis_function.modal_coefficient_ * monomial_value;
+  return true;
+}
+
+template <typename SimulationControl>
+inline bool locateMeshProbe(const Mesh<SimulationControl>& mesh,
+                            const ProbeBasisFunction<SimulationControl>& probe_basis_function,
+                            const ProbeBoundingBox<SimulationControl::kDimension>& bounding_box,
+                            const Eigen::Vector<Real, SimulationControl::kDimension>& coordinate,
+                            Eigen::Vector<Real, Eigen::Dynamic>& modal_value, const bool is_extrapolated = false) {
+  if constexpr (SimulationControl::kDimension == 1) {
+    return locateElementProbe(mesh.line_, probe_basis_function.line_, bounding_box.element_index_, coordinate,
+                              modal_value, is_extrapolated);
+  } else if constexpr (SimulationControl::kDimension == 2) {
+    if (bounding_box.gmsh_type_ == TriangleTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+      return locateElementProbe(mesh.triangle_, probe_basis_function.triangle_, bounding_box.element_index_,
+                                coordinate, modal_value, is_extrapolated);
+    }
+    if (bounding_box.gmsh_type_ == QuadrangleTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+      return locateElementProbe(mesh.quadrangle_, probe_basis_function.quadrangle_, bounding_box.element_index_,
+                                coordinate, modal_value, is_extrapolated);
+    }
+  } else if constexpr (SimulationControl::kDimension == 3) {
+    if (bounding_box.gmsh_type_ == TetrahedronTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+      return locateElementProbe(mesh.tetrahedron_, probe_basis_function.tetrahedron_, bounding_box.element_index_,
+                                coordinate, modal_value, is_extrapolated);
+    }
+    if (bounding_box.gmsh_type_ == PyramidTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+      return locateElementProbe(mesh.pyramid_, probe_basis_function.pyramid_, bounding_box.element_index_, coordinate,
+                                modal_value, is_extrapolated);
+    }
+    if (bounding_box.gmsh_type_ == HexahedronTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+      return locateElementProbe(mesh.hexahedron_, probe_basis_function.hexahedron_, bounding_box.element_index_,
+                                coordinate, modal_value, is_extrapolated);
+    }
+  }
+  return false;
+}
+
+template <typename SimulationControl>
+struct PerProbe {
+  Eigen::Vector<Real, SimulationControl::kDimension> coordinate_;
+  int gmsh_type_{-1};
+  Isize element_index_{-1};
+  Eigen::Vector<Real, Eigen::Dynamic> modal_value_;
+};
+
+// NOTE: The probe file starts with the magic, the version, the dimension, the probe number, the variable number and the
+// probe coordinates, every record then holds the step, the time value and the computational variables (density,
+// velocity, internal energy and pressure) of each probe, all values are written as little endian doubles.
+template <typename SimulationControl>
+struct Probe {
+  bool is_open_{false};
+  int interval_{1};
+  std::vector<PerProbe<SimulationControl>> probe_;
+  ProbeBoundingVolumeHierarchy<SimulationControl::kDimension> bounding_volume_hierarchy_;
+  ProbeBasisFunction<SimulationControl> probe_basis_function_;
+  std::fstream probe_fout_;
+  std::vector<double> record_;
+
+  [[nodiscard]] inline std::vector<char> getProbeHeader() const {
+    const std::array<std::uint32_t, 4> header{
+        kProbeVersion, static_cast<std::uint32_t>(SimulationControl::kDimension),
+        static_cast<std::uint32_t>(this->probe_.size()),
+        static_cast<std::uint32_t>(SimulationControl::kComputationalVariableNumber)};
+    std::vector<char> probe_header{kProbeMagic.begin(), kProbeMagic.end()};
+    probe_header.insert(probe_header.end(), reinterpret_cast<const char*>(header.data()),
+                        reinterpret_cast<const char*>(header.data() + header.size()));
+    for (const PerProbe<SimulationControl>& probe : this->probe_) {
+      const Eigen::Vector<double, SimulationControl::kDimension> coordinate = probe.coordinate_.template cast<double>();
+      probe_header.insert(probe_header.end(), reinterpret_cast<const char*>(coordinate.data()),
+                          reinterpret_cast<const char*>(coordinate.data() + SimulationControl::kDimension));
+    }
+    return probe_header;
+  }
+
+  // NOTE: A restart continues the history after its restart step, so the records an earlier run wrote after that step
+  // and a partial record of an interrupted write are cut off before appending. A history of another probe set can not
+  // be continued and is written anew.
+  [[nodiscard]] inline bool truncateProbeHistory(const std::filesystem::path& probe_file_path,
+                                                 const std::vector<char>& probe_header,
+                                                 const int iteration_start) const {
+    const std::uintmax_t header_size = probe_header.size();
+    const std::uintmax_t file_size = std::filesystem::file_size(probe_file_path);
+    if (file_size < header_size) {
+      return false;
+    }
+    std::ifstream fin(probe_file_path, std::ios::in | std::ios::binary);
+    std::vector<char> file_header(probe_header.size());
+    fin.read(file_header.data(), static_cast<std::streamsize>(file_header.size()));
+    if (!fin || file_header != probe_header) {
+      return false;
+    }
+    const std::uintmax_t record_size = this->record_.size() * sizeof(double);
+    std::uintmax_t record_number = (file_size - header_size) / record_size;
+    for (std::uintmax_t i = 0; i < record_number; i++) {
+      double step;
+      fin.seekg(static_cast<std::streamoff>(header_size + i * record_size));
+      fin.read(reinterpret_cast<char*>(&step), sizeof(double));
+      if (!fin || step > static_cast<double>(iteration_start)) {
+        record_number = i;
+        break;
+      }
+    }
+    fin.close();
+    std::filesystem::resize_file(probe_file_path, header_size + record_number * record_size);
+    return true;
+  }
+
+  inline void initializeProbe(const Mesh<SimulationControl>& mesh, const std::filesystem::path& probe_file_path,
+                              const int iteration_start, const bool is_append) {
+    this->bounding_volume_hierarchy_.build(mesh);
+    this->probe_basis_function_.initializeProbeBasisFunction();
+    for (PerProbe<SimulationControl>& probe : this->probe_) {
+      if (!this->bounding_volume_hierarchy_.find(
+              probe.coordinate_, [&](const ProbeBoundingBox<SimulationControl::kDimension>& bounding_box) {
+                if (locateMeshProbe(mesh, this->probe_basis_function_, bounding_box, probe.coordinate_,
+                                    probe.modal_value_)) {
+                  probe.gmsh_type_ = bounding_box.gmsh_type_;
+                  probe.element_index_ = bounding_box.element_index_;
+                  return true;
+                }
+                return false;
+              })) [[unlikely]] {
+        std::string coordinate;
+        for (Isize i = 0; i < SimulationControl::kDimension; i++) {
+          coordinate += std::format("{}{}", i == 0 ? "" : ", ", probe.coordinate_(i));
+        }
+        throw std::runtime_error(std::format("Probe at ({}) is outside the mesh.", coordinate));
+      }
+    }
+    this->record_.resize(2 + this->probe_.size() *
+                                 static_cast<std::size_t>(SimulationControl::kComputationalVariableNumber));
+    std::filesystem::create_directories(probe_file_path.parent_path());
+    const std::vector<char> probe_header{this->getProbeHeader()};
+    const bool is_header_needed = !is_append || !std::filesystem::exists(probe_file_path) ||
+                                  !this->truncateProbeHistory(probe_file_path, probe_header, iteration_start);
+    this->probe_fout_.open(probe_file_path,
+                           std::ios::out | std::ios::binary | (is_header_needed ? std::ios::trunc : std::ios::app));
+    if (is_header_needed) {
+      this->probe_fout_.write(probe_header.data(), static_cast<std::streamsize>(probe_header.size()));
+    }
+    this->is_open_ = true;
+  }
+
+  template <typename ElementTrait>
+  inline void getElementProbeVariable(const Solver<SimulationControl>& solver, const PerProbe<SimulationControl>& probe,
+                                      Variable<SimulationControl, 1>& variable) {
+    const ElementSolver<ElementTrait, SimulationControl>& element_solver =
+        solver.*(Solver<SimulationControl>::template getElement<ElementTrait>());
+    variable.conserved_.noalias() =
+        element_solver.element_(probe.element_index_).variable_basis_function_coefficient_ * probe.modal_value_;
+  }
+
+  inline void writeProbe(const int step, const Real time_value, const Solver<SimulationControl>& solver,
+                         const PhysicalModel<SimulationControl>& physical_model) {
+    this->record_[0] = static_cast<double>(step);
+    this->record_[1] = static_cast<double>(time_value);
+    Variable<SimulationControl, 1> variable;
+    for (std::size_t i = 0; i < this->probe_.size(); i++) {
+      const PerProbe<SimulationControl>& probe = this->probe_[i];
+      if constexpr (SimulationControl::kDimension == 1) {
+        this->getElementProbeVariable<LineTrait<SimulationControl::kPolynomialOrder>>(solver, probe, variable);
+      } else if constexpr (SimulationControl::kDimension == 2) {
+        if (probe.gmsh_type_ == TriangleTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+          this->getElementProbeVariable<TriangleTrait<SimulationControl::kPolynomialOrder>>(solver, probe, variable);
+        } else if (probe.gmsh_type_ == QuadrangleTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+          this->getElementProbeVariable<QuadrangleTrait<SimulationControl::kPolynomialOrder>>(solver, probe, variable);
+        }
+      } else if constexpr (SimulationControl::kDimension == 3) {
+        if (probe.gmsh_type_ == TetrahedronTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+          this->getElementProbeVariable<TetrahedronTrait<SimulationControl::kPolynomialOrder>>(solver, probe, variable);
+        } else if (probe.gmsh_type_ == PyramidTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+          this->getElementProbeVariable<PyramidTrait<SimulationControl::kPolynomialOrder>>(solver, probe, variable);
+        } else if (probe.gmsh_type_ == HexahedronTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+          this->getElementProbeVariable<HexahedronTrait<SimulationControl::kPolynomialOrder>>(solver, probe, variable);
+        }
+      }
+      variable.calculateComputationalFromConserved(physical_model);
+      double* probe_record =
+          this->record_.data() + 2 + i * static_cast<std::size_t>(SimulationControl::kComputationalVariableNumber);
+      for (Isize j = 0; j < SimulationControl::kComputationalVariableNumber; j++) {
+        probe_record[j] = static_cast<double>(variable.computational_(j, 0));
+      }
+    }
+    this->probe_fout_.write(reinterpret_cast<const char*>(this->record_.data()),
+                            static_cast<std::streamsize>(this->record_.size() * sizeof(double)));
+  }
+
+  inline void finalizeProbe() {
+    if (this->probe_fout_.is_open()) {
+      this->probe_fout_.close();
+    }
+    this->is_open_ = false;
+  }
+};
+
+}  // namespace SubrosaDG
+
+#endif  // SUBROSA_DG_PROBE_CPP_
@@ -13,18 +13,15 @@
 #ifndef SUBROSA_DG_RAW_BINARY_CPP_
 #define SUBROSA_DG_RAW_BINARY_CPP_
 
-#include <zstd.h>
-
 #include <Eigen/Core>
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <filesystem>
-#include <fstream>
-#include <functional>
-#include <future>
-#include <iterator>
-#include <sstream>
-#include <string>
+#include <format>
+#include <magic_enum/magic_enum.hpp>
+#include <stdexcept>
 #include <vector>
 
 #include "Mesh/ReadControl.cpp"
@@ -35,65 +32,265 @@
 #include "Utils/Concept.cpp"
 #include "Utils/Constant.cpp"
 #include "Utils/Enum.cpp"
+#include "Utils/ParallelControl.cpp"
 #include "View/IOControl.cpp"
+#include "View/RawBinaryCompress.cpp"
 
 namespace SubrosaDG {
 
-struct RawBinaryCompress {
-  inline static void write(const std::filesystem::path& raw_binary_path, std::stringstream& raw_binary_ss) {
-    raw_binary_ss.seekg(0, std::ios::beg);
-    raw_binary_ss.seekp(0, std::ios::beg);
-    std::fstream raw_binary_fout(raw_binary_path, std::ios::out | std::ios::binary | std::ios::trunc);
-    std::size_t compressed_size = ZSTD_compressBound(static_cast<std::size_t>(raw_binary_ss.str().size()));
-    raw_binary_fout.write(reinterpret_cast<const char*>(&compressed_size),
-                          static_cast<std::streamsize>(sizeof(std::size_t)));
-    std::vector<char> compressed(compressed_size);
-    std::size_t actual_size =
-        ZSTD_compress(compressed.data(), compressed_size, raw_binary_ss.str().data(), raw_binary_ss.str().size(), 1);
-    raw_binary_fout.write(compressed.data(), static_cast<std::streamsize>(actual_size));
-    raw_binary_fout.close();
+template <typename AdjacencyElementTrait, typename SimulationControl>
+inline std::size_t getAdjacencyParentElementRawBinarySize([[maybe_unused]] const Isize parent_gmsh_type_number) {
+  if constexpr (AdjacencyElementTrait::kElementType == ElementEnum::Point) {
+    return getElementRawBinarySize<LineTrait<SimulationControl::kPolynomialOrder>, SimulationControl>();
+  } else if constexpr (AdjacencyElementTrait::kElementType == ElementEnum::Line) {
+    if (parent_gmsh_type_number == TriangleTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+      return getElementRawBinarySize<TriangleTrait<SimulationControl::kPolynomialOrder>, SimulationControl>();
+    }
+    return getElementRawBinarySize<QuadrangleTrait<SimulationControl::kPolynomialOrder>, SimulationControl>();
+  } else if constexpr (AdjacencyElementTrait::kElementType == ElementEnum::Triangle) {
+    if (parent_gmsh_type_number == TetrahedronTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+      return getElementRawBinarySize<TetrahedronTrait<SimulationControl::kPolynomialOrder>, SimulationControl>();
+    }
+    return getElementRawBinarySize<PyramidTrait<SimulationControl::kPolynomialOrder>, SimulationControl>();
+  } else if constexpr (AdjacencyElementTrait::kElementType == ElementEnum::Quadrangle) {
+    if (parent_gmsh_type_number == PyramidTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+      return getElementRawBinarySize<PyramidTrait<SimulationControl::kPolynomialOrder>, SimulationControl>();
+    }
+    return getElementRawBinarySize<HexahedronTrait<SimulationControl::kPolynomialOrder>, SimulationControl>();
   }
+  return 0;
+}
+
+inline std::size_t getRawBinaryValueSize(const RawBinaryTypeEnum raw_binary_type) {
+  return raw_binary_type == RawBinaryTypeEnum::Quantized ? sizeof(float) : sizeof(Real);
+}
+
+template <typename ElementTrait, typename SimulationControl>
+inline void addElementRawBinaryBlock(const ElementMesh<ElementTrait>& element_mesh,
+                                     const RawBinaryTypeEnum raw_binary_type, std::vector<RawBinaryBlock>& block,
+                                     std::size_t& raw_binary_offset) {
+  RawBinaryBlock& element_block = block.emplace_back();
+  element_block.type_ = magic_enum::enum_integer(RawBinaryBlockEnum::Element);
+  element_block.gmsh_type_number_ = ElementTrait::kGmshTypeNumber;
+  element_block.number_ = element_mesh.number_;
+  element_block.shuffle_size_ = static_cast<std::int32_t>(getRawBinaryValueSize(raw_binary_type));
+  element_block.offset_ = raw_binary_offset;
+  element_block.size_ = static_cast<std::size_t>(element_mesh.number_) *
+                        getElementRawBinarySize<ElementTrait, SimulationControl>(raw_binary_type ==
+                                                                                 RawBinaryTypeEnum::Compact) /
+                        sizeof(Real) * getRawBinaryValueSize(raw_binary_type);
+  raw_binary_offset += element_block.size_;
+}
 
-  inline static void read(const std::filesystem::path& raw_binary_path, std::stringstream& raw_binary_ss) {
-    raw_binary_ss.seekg(0, std::ios::beg);
-    raw_binary_ss.seekp(0, std::ios::beg);
-    std::fstream raw_binary_fin(raw_binary_path, std::ios::in | std::ios::binary);
-    std::size_t original_size;
-    raw_binary_fin.read(reinterpret_cast<char*>(&original_size), static_cast<std::streamsize>(sizeof(std::size_t)));
-    raw_binary_fin.seekg(0, std::ios::end);
-    std::streamoff actual_size = raw_binary_fin.tellg() - static_cast<std::streamoff>(sizeof(std::size_t));
-    raw_binary_fin.seekg(static_cast<std::streamoff>(sizeof(std::size_t)));
-    std::vector<char> compressed(static_cast<std::size_t>(actual_size));
-    raw_binary_fin.read(compressed.data(), actual_size);
-    std::vector<char> decompressed(original_size);
-    ZSTD_decompress(decompressed.data(), original_size, compressed.data(), static_cast<std::size_t>(actual_size));
-    raw_binary_ss << std::string(decompressed.data(), original_size);
-    raw_binary_fin.close();
+template <typename AdjacencyElementTrait, typename SimulationControl>
+inline void addBoundaryAdjacencyElementRawBinaryBlock(
+    const AdjacencyElementMesh<AdjacencyElementTrait>& adjacency_element_mesh, const RawBinaryTypeEnum raw_binary_type,
+    std::vector<RawBinaryBlock>& block, std::size_t& raw_binary_offset) {
+  RawBinaryBlock& adjacency_element_block = block.emplace_back();
+  adjacency_element_block.type_ = magic_enum::enum_integer(RawBinaryBlockEnum::BoundaryAdjacencyElement);
+  adjacency_element_block.gmsh_type_number_ = AdjacencyElementTrait::kGmshTypeNumber;
+  adjacency_element_block.number_ = adjacency_element_mesh.boundary_number_;
+  adjacency_element_block.shuffle_size_ = static_cast<std::int32_t>(getRawBinaryValueSize(raw_binary_type));
+  adjacency_element_block.offset_ = raw_binary_offset;
+  for (Isize i = 0; i < adjacency_element_mesh.boundary_number_; i++) {
+    adjacency_element_block.size_ += getAdjacencyParentElementRawBinarySize<AdjacencyElementTrait, SimulationControl>(
+        adjacency_element_mesh.element_(i + adjacency_element_mesh.interior_number_).parent_gmsh_type_number_(0));
   }
-};
+  adjacency_element_block.size_ = adjacency_element_block.size_ / sizeof(Real) * getRawBinaryValueSize(raw_binary_type);
+  raw_binary_offset += adjacency_element_block.size_;
+}
+
+// NOTE: The block table follows the order in which the solver packs the snapshot, the reader compares a file against
+// the same table so a snapshot from another mesh or another build is rejected before it is used. A compact snapshot
+// only has the element blocks, a quantized snapshot stores every value in single precision.
+template <typename SimulationControl>
+inline void getRawBinaryBlock(const Mesh<SimulationControl>& mesh, const RawBinaryTypeEnum raw_binary_type,
+                              std::vector<RawBinaryBlock>& block) {
+  const bool is_compact = raw_binary_type == RawBinaryTypeEnum::Compact;
+  std::size_t raw_binary_offset = 0;
+  block.clear();
+  if constexpr (SimulationControl::kDimension == 1) {
+    addElementRawBinaryBlock<LineTrait<SimulationControl::kPolynomialOrder>, SimulationControl>(
+        mesh.line_, raw_binary_type, block, raw_binary_offset);
+    if (!is_compact) {
+      addBoundaryAdjacencyElementRawBinaryBlock<AdjacencyPointTrait<SimulationControl::kPolynomialOrder>,
+                                                SimulationControl>(mesh.point_, raw_binary_type, block,
+                                                                   raw_binary_offset);
+    }
+  } else if constexpr (SimulationControl::kDimension == 2) {
+    if constexpr (HasTriangle<SimulationControl::kMeshModel>) {
+      addElementRawBinaryBlock<TriangleTrait<SimulationControl::kPolynomialOrder>, SimulationControl>(
+          mesh.triangle_, raw_binary_type, block, raw_binary_offset);
+    }
+    if constexpr (HasQuadrangle<SimulationControl::kMeshModel>) {
+      addElementRawBinaryBlock<QuadrangleTrait<SimulationControl::kPolynomialOrder>, SimulationControl>(
+          mesh.quadrangle_, raw_binary_type, block, raw_binary_offset);
+    }
+    if (!is_compact) {
+      addBoundaryAdjacencyElementRawBinaryBlock<AdjacencyLineTrait<SimulationControl::kPolynomialOrder>,
+                                                SimulationControl>(mesh.line_, raw_binary_type, block,
+                                                                   raw_binary_offset);
+    }
+  } else if constexpr (SimulationControl::kDimension == 3) {
+    if constexpr (HasTetrahedron<SimulationControl::kMeshModel>) {
+      addElementRawBinaryBlock<TetrahedronTrait<SimulationControl::kPolynomialOrder>, SimulationControl>(
+          mesh.tetrahedron_, raw_binary_type, block, raw_binary_offset);
+    }
+    if constexpr (HasPyramid<SimulationControl::kMeshModel>) {
+      addElementRawBinaryBlock<PyramidTrait<SimulationControl::kPolynomialOrder>, SimulationControl>(
+          mesh.pyramid_, raw_binary_type, block, raw_binary_offset);
+    }
+    if constexpr (HasHexahedron<SimulationControl::kMeshModel>) {
+      addElementRawBinaryBlock<HexahedronTrait<SimulationControl::kPolynomialOrder>, SimulationControl>(
+          mesh.hexahedron_, raw_binary_type, block, raw_binary_offset);
+    }
+    if constexpr (HasAdjacencyTriangle<SimulationControl::kMeshModel>) {
+      if (!is_compact) {
+        addBoundaryAdjacencyElementRawBinaryBlock<AdjacencyTriangleTrait<SimulationControl::kPolynomialOrder>,
+                                                  SimulationControl>(mesh.triangle_, raw_binary_type, block,
+                                                                     raw_binary_offset);
+      }
+    }
+    if constexpr (HasAdjacencyQuadrangle<SimulationControl::kMeshModel>) {
+      if (!is_compact) {
+        addBoundaryAdjacencyElementRawBinaryBlock<AdjacencyQuadrangleTrait<SimulationControl::kPolynomialOrder>,
+                                                  SimulationControl>(mesh.quadrangle_, raw_binary_type, block,
+                                                                     raw_binary_offset);
+      }
+    }
+  }
+  if (is_compact) {
+    return;
+  }
+  RawBinaryBlock& node_artificial_viscosity_block = block.emplace_back();
+  node_artificial_viscosity_block.type_ = magic_enum::enum_integer(RawBinaryBlockEnum::NodeArtificialViscosity);
+  node_artificial_viscosity_block.number_ = mesh.node_number_;
+  node_artificial_viscosity_block.shuffle_size_ = static_cast<std::int32_t>(getRawBinaryValueSize(raw_binary_type));
+  node_artificial_viscosity_block.offset_ = raw_binary_offset;
+  node_artificial_viscosity_block.size_ =
+      static_cast<std::size_t>(mesh.node_number_) * getRawBinaryValueSize(raw_binary_type);
+}
+
+template <typename SimulationControl>
+inline void getRawBinaryHeader(const Mesh<SimulationControl>& mesh,
+                               const TimeIntegration<SimulationControl>& time_integration,
+                               const RawBinaryTypeEnum raw_binary_type, RawBinaryHeader& header) {
+  header.real_size_ = static_cast<std::int32_t>(kRealSize);
+  header.dimension_ = SimulationControl::kDimension;
+  header.polynomial_order_ = SimulationControl::kPolynomialOrder;
+  header.equation_model_ = magic_enum::enum_integer(SimulationControl::kEquationModel);
+  header.conserved_variable_number_ = SimulationControl::kConservedVariableNumber;
+  header.node_number_ = mesh.node_number_;
+  header.iteration_ = time_integration.iteration_;
+  header.time_ = static_cast<double>(time_integration.iteration_) * static_cast<double>(time_integration.delta_time_);
+  header.delta_time_ = static_cast<double>(time_integration.delta_time_);
+  header.type_ = magic_enum::enum_integer(raw_binary_type);
+  header.reference_iteration_ = -1;
+  header.keyframe_iteration_ = time_integration.iteration_;
+}
+
+// NOTE: A snapshot from a lower polynomial order is accepted as initial condition, its block sizes are then not
+// compared since they follow the order in the file. The block table of a subset snapshot depends on the subset and is
+// compared by the subset that reads it.
+template <typename SimulationControl>
+inline void checkRawBinary(const std::filesystem::path& raw_binary_path, const RawBinaryHeader& header,
+                           const std::vector<RawBinaryBlock>& block, const Mesh<SimulationControl>& mesh,
+                           const int polynomial_order, const bool is_restart = false) {
+  const auto equation_model = magic_enum::enum_cast<EquationModelEnum>(header.equation_model_);
+  const auto raw_binary_type = magic_enum::enum_cast<RawBinaryTypeEnum>(header.type_);
+  if (!raw_binary_type.has_value() ||
+      (is_restart && (raw_binary_type.value() == RawBinaryTypeEnum::Quantized ||
+                      raw_binary_type.value() == RawBinaryTypeEnum::Subset))) [[unlikely]] {
+    throw std::runtime_error(
+        std::format("Raw binary file {} can not be used here: type {}.", raw_binary_path.string(),
+                    raw_binary_type.has_value() ? magic_enum::enum_name(raw_binary_type.value()) : "Unknown"));
+  }
+  if (header.real_size_ != static_cast<std::int32_t>(kRealSize) || header.dimension_ != SimulationControl::kDimension ||
+      header.polynomial_order_ != polynomial_order || equation_model != SimulationControl::kEquationModel ||
+      header.conserved_variable_number_ != SimulationControl::kConservedVariableNumber ||
+      header.node_number_ != mesh.node_number_) [[unlikely]] {
+    throw std::runtime_error(std::format(
+        "Raw binary file {} is written by another build: real size {}, dimension {}, polynomial order {}, equation "
+        "model {}, node number {}.",
+        raw_binary_path.string(), header.real_size_, header.dimension_, header.polynomial_order_,
+        equation_model.has_value() ? magic_enum::enum_name(equation_model.value()) : "Unknown", header.node_number_));
+  }
+  if (raw_binary_type.value() == RawBinaryTypeEnum::Subset) {
+    return;
+  }
+  std::vector<RawBinaryBlock> mesh_block;
+  getRawBinaryBlock(mesh, raw_binary_type.value(), mesh_block);
+  if (block.size() != mesh_block.size()) [[unlikely]] {
+    throw std::runtime_error(std::format("Raw binary file {} has {} blocks but the mesh needs {}.",
+                                         raw_binary_path.string(), block.size(), mesh_block.size()));
+  }
+  for (std::size_t i = 0; i < block.size(); i++) {
+    if (block[i].type_ != mesh_block[i].type_ || block[i].gmsh_type_number_ != mesh_block[i].gmsh_type_number_ ||
+        block[i].number_ != mesh_block[i].number_ ||
+        (polynomial_order == SimulationControl::kPolynomialOrder &&
+         (block[i].offset_ != mesh_block[i].offset_ || block[i].size_ != mesh_block[i].size_))) [[unlikely]] {
+      throw std::runtime_error(
+          std::format("Raw binary file {} does not match the mesh at block {}.", raw_binary_path.string(), i));
+    }
+  }
+}
 
 template <typename ElementTrait, typename SimulationControl>
 inline void ElementSolver<ElementTrait, SimulationControl>::writeElementRawBinary(
-    std::stringstream& raw_binary_ss) const {
-  for (Isize i = 0; i < this->number_; i++) {
-    raw_binary_ss.write(reinterpret_cast<const char*>(this->element_(i).variable_basis_function_coefficient_.data()),
-                        SimulationControl::kConservedVariableNumber * ElementTrait::kBasisFunctionNumber * kRealSize);
-    if constexpr (IsNS<SimulationControl::kEquationModel>) {
-      raw_binary_ss.write(
-          reinterpret_cast<const char*>(this->element_(i).variable_gradient_basis_function_coefficient_.data()),
-          SimulationControl::kConservedVariableNumber * SimulationControl::kDimension *
-              ElementTrait::kBasisFunctionNumber * kRealSize);
-    }
+    const bool is_compact, std::vector<char>& raw_binary, std::size_t& raw_binary_offset) const {
+  constexpr std::size_t kBasisFunctionCoefficientSize{
+      static_cast<std::size_t>(SimulationControl::kConservedVariableNumber * ElementTrait::kBasisFunctionNumber *
+                               kRealSize)};
+  const std::size_t element_raw_binary_size{getElementRawBinarySize<ElementTrait, SimulationControl>(is_compact)};
+  const std::size_t element_raw_binary_offset = raw_binary_offset;
+  raw_binary_offset += static_cast<std::size_t>(this->number_) * element_raw_binary_size;
+  if (raw_binary.size() < raw_binary_offset) {
+    raw_binary.resize(raw_binary_offset);
   }
+  parallelFor(0, this->number_, [&](const tbb::blocked_range<Isize>& range) {
+    for (Isize i = range.begin(); i != range.end(); i++) {
+      char* element_raw_binary =
+          raw_binary.data() + element_raw_binary_offset + static_cast<std::size_t>(i) * element_raw_binary_size;
+      std::memcpy(element_raw_binary, this->element_(i).variable_basis_function_coefficient_.data(),
+                  kBasisFunctionCoefficientSize);
+      if constexpr (IsNS<SimulationControl::kEquationModel>) {
+        if (!is_compact) {
+          std::memcpy(element_raw_binary + kBasisFunctionCoefficientSize,
+                      this->element_(i).variable_gradient_basis_function_coefficient_.data(),
+                      element_raw_binary_size - kBasisFunctionCoefficientSize);
+        }
+      }
+    }
+  });
+}
+
+template <typename ElementTrait, typename SimulationControl>
+inline void ElementSolver<ElementTrait, SimulationControl>::readElementRawBinary(const bool is_compact,
+                                                                                 const std::vector<char>& raw_binary,
+                                                                                 std::size_t& raw_binary_offset) {
+  const std::size_t element_raw_binary_size{getElementRawBinarySize<ElementTrait, SimulationControl>(is_compact)};
+  parallelFor(0, this->number_, [&](const tbb::blocked_range<Isize>& range) {
+    for (Isize i = range.begin(); i != range.end(); i++) {
+      std::memcpy(this->element_(i).variable_basis_function_coefficient_.data(),
+                  raw_binary.data() + raw_binary_offset + static_cast<std::size_t>(i) * element_raw_binary_size,
+                  static_cast<std::size_t>(SimulationControl::kConservedVariableNumber *
+                                           ElementTrait::kBasisFunctionNumber * kRealSize));
+    }
+  });
+  raw_binary_offset += static_cast<std::size_t>(this->number_) * element_raw_binary_size;
 }
+
 template <typename AdjacencyElementTrait, typename SimulationControl>
 template <typename ElementTrait>
 inline void AdjacencyElementSolver<AdjacencyElementTrait, SimulationControl>::writeBoundaryAdjacencyPerElementRawBinary(
-    const ElementSolver<ElementTrait, SimulationControl>& element_solver, std::stringstream& raw_binary_ss,
+    const ElementSolver<ElementTrait, SimulationControl>& element_solver, char* raw_binary,
     const Isize parent_index_each_type, [[maybe_unused]] const Isize adjacency_sequence_in_parent) const {
-  raw_binary_ss.write(reinterpret_cast<const char*>(
-                          element_solver.element_(parent_index_each_type).variable_basis_function_coefficient_.data()),
-                      SimulationControl::kConservedVariableNumber * ElementTrait::kBasisFunctionNumber * kRealSize);
+  constexpr std::size_t kBasisFunctionCoefficientSize{
+      static_cast<std::size_t>(SimulationControl::kConservedVariableNumber * ElementTrait::kBasisFunctionNumber *
+                               kRealSize)};
+  std::memcpy(raw_binary,
+              element_solver.element_(parent_index_each_type).variable_basis_function_coefficient_.data(),
+              kBasisFunctionCoefficientSize);
   if constexpr (IsNS<SimulationControl::kEquationModel>) {
     Eigen::Matrix<Real, SimulationControl::kConservedVariableNumber * SimulationControl::kDimension,
                   ElementTrait::kBasisFunctionNumber>
@@ -107,137 +304,250 @@ inline void AdjacencyElementSolver<AdjacencyElementTrait, SimulationControl>::wr
           element_solver.element_(parent_index_each_type)
               .variable_interface_gradient_basis_function_coefficient_(adjacency_sequence_in_parent);
     }
-    raw_binary_ss.write(reinterpret_cast<const char*>(variable_gradient_basis_function_coefficient.data()),
-                        SimulationControl::kConservedVariableNumber * SimulationControl::kDimension *
-                            ElementTrait::kBasisFunctionNumber * kRealSize);
+    std::memcpy(raw_binary + kBasisFunctionCoefficientSize, variable_gradient_basis_function_coefficient.data(),
+                getElementRawBinarySize<ElementTrait, SimulationControl>() - kBasisFunctionCoefficientSize);
   }
 }
 
 template <typename AdjacencyElementTrait, typename SimulationControl>
 inline void AdjacencyElementSolver<AdjacencyElementTrait, SimulationControl>::writeBoundaryAdjacencyElementRawBinary(
     const AdjacencyElementMesh<AdjacencyElementTrait>& adjacency_element_mesh, const Solver<SimulationControl>& solver,
-    std::stringstream& raw_binary_ss) const {
-  for (Isize i = adjacency_element_mesh.interior_number_;
-       i < adjacency_element_mesh.boundary_number_ + adjacency_element_mesh.interior_number_; i++) {
-    const Isize parent_index_each_type = adjacency_element_mesh.element_(i).parent_index_each_type_(0);
-    const Isize adjacency_sequence_in_parent = adjacency_element_mesh.element_(i).adjacency_sequence_in_parent_(0);
-    const Isize parent_gmsh_type_number = adjacency_element_mesh.element_(i).parent_gmsh_type_number_(0);
-    if constexpr (AdjacencyElementTrait::kElementType == ElementEnum::Point) {
-      this->writeBoundaryAdjacencyPerElementRawBinary<LineTrait<SimulationControl::kPolynomialOrder>>(
-          solver.line_, raw_binary_ss, parent_index_each_type, adjacency_sequence_in_parent);
-    } else if constexpr (AdjacencyElementTrait::kElementType == ElementEnum::Line) {
-      if (parent_gmsh_type_number == TriangleTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
-        this->writeBoundaryAdjacencyPerElementRawBinary<TriangleTrait<SimulationControl::kPolynomialOrder>>(
-            solver.triangle_, raw_binary_ss, parent_index_each_type, adjacency_sequence_in_parent);
-      } else if (parent_gmsh_type_number == QuadrangleTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
-        this->writeBoundaryAdjacencyPerElementRawBinary<QuadrangleTrait<SimulationControl::kPolynomialOrder>>(
-            solver.quadrangle_, raw_binary_ss, parent_index_each_type, adjacency_sequence_in_parent);
-      }
-    } else if constexpr (AdjacencyElementTrait::kElementType == ElementEnum::Triangle) {
-      if (parent_gmsh_type_number == TetrahedronTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
-        this->writeBoundaryAdjacencyPerElementRawBinary<TetrahedronTrait<SimulationControl::kPolynomialOrder>>(
-            solver.tetrahedron_, raw_binary_ss, parent_index_each_type, adjacency_sequence_in_parent);
-      } else if (parent_gmsh_type_number == PyramidTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
-        this->writeBoundaryAdjacencyPerElementRawBinary<PyramidTrait<SimulationControl::kPolynomialOrder>>(
-            solver.pyramid_, raw_binary_ss, parent_index_each_type, adjacency_sequence_in_parent);
-      }
-    } else if constexpr (AdjacencyElementTrait::kElementType == ElementEnum::Quadrangle) {
-      if (parent_gmsh_type_number == PyramidTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
-        this->writeBoundaryAdjacencyPerElementRawBinary<PyramidTrait<SimulationControl::kPolynomialOrder>>(
-            solver.pyramid_, raw_binary_ss, parent_index_each_type, adjacency_sequence_in_parent);
-      } else if (parent_gmsh_type_number == HexahedronTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
-        this->writeBoundaryAdjacencyPerElementRawBinary<HexahedronTrait<SimulationControl::kPolynomialOrder>>(
-            solver.hexahedron_, raw_binary_ss, parent_index_each_type, adjacency_sequence_in_parent);
+    std::vector<char>& raw_binary, std::size_t& raw_binary_offset) const {
+  // NOTE: The block size depends on the parent element type, so the offsets are accumulated before the parallel copy.
+  std::vector<std::size_t> adjacency_raw_binary_offset(static_cast<Usize>(adjacency_element_mesh.boundary_number_) + 1);
+  adjacency_raw_binary_offset[0] = raw_binary_offset;
+  for (Isize i = 0; i < adjacency_element_mesh.boundary_number_; i++) {
+    adjacency_raw_binary_offset[static_cast<Usize>(i) + 1] =
+        adjacency_raw_binary_offset[static_cast<Usize>(i)] +
+        getAdjacencyParentElementRawBinarySize<AdjacencyElementTrait, SimulationControl>(
+            adjacency_element_mesh.element_(i + adjacency_element_mesh.interior_number_).parent_gmsh_type_number_(0));
+  }
+  raw_binary_offset = adjacency_raw_binary_offset.back();
+  if (raw_binary.size() < raw_binary_offset) {
+    raw_binary.resize(raw_binary_offset);
+  }
+  parallelFor(0, adjacency_element_mesh.boundary_number_, [&](const tbb::blocked_range<Isize>& range) {
+    for (Isize i = range.begin(); i != range.end(); i++) {
+      const Isize parent_index_each_type =
+          adjacency_element_mesh.element_(i + adjacency_element_mesh.interior_number_).parent_index_each_type_(0);
+      const Isize adjacency_sequence_in_parent =
+          adjacency_element_mesh.element_(i + adjacency_element_mesh.interior_number_).adjacency_sequence_in_parent_(0);
+      const Isize parent_gmsh_type_number =
+          adjacency_element_mesh.element_(i + adjacency_element_mesh.interior_number_).parent_gmsh_type_number_(0);
+      char* adjacency_raw_binary = raw_binary.data() + adjacency_raw_binary_offset[static_cast<Usize>(i)];
+      if constexpr (AdjacencyElementTrait::kElementType == ElementEnum::Point) {
+        this->writeBoundaryAdjacencyPerElementRawBinary<LineTrait<SimulationControl::kPolynomialOrder>>(
+            solver.line_, adjacency_raw_binary, parent_index_each_type, adjacency_sequence_in_parent);
+      } else if constexpr (AdjacencyElementTrait::kElementType == ElementEnum::Line) {
+        if (parent_gmsh_type_number == TriangleTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+          this->writeBoundaryAdjacencyPerElementRawBinary<TriangleTrait<SimulationControl::kPolynomialOrder>>(
+              solver.triangle_, adjacency_raw_binary, parent_index_each_type, adjacency_sequence_in_parent);
+        } else if (parent_gmsh_type_number == QuadrangleTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+          this->writeBoundaryAdjacencyPerElementRawBinary<QuadrangleTrait<SimulationControl::kPolynomialOrder>>(
+              solver.quadrangle_, adjacency_raw_binary, parent_index_each_type, adjacency_sequence_in_parent);
+        }
+      } else if constexpr (AdjacencyElementTrait::kElementType == ElementEnum::Triangle) {
+        if (parent_gmsh_type_number == TetrahedronTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+          this->writeBoundaryAdjacencyPerElementRawBinary<TetrahedronTrait<SimulationControl::kPolynomialOrder>>(
+              solver.tetrahedron_, adjacency_raw_binary, parent_index_each_type, adjacency_sequence_in_parent);
+        } else if (parent_gmsh_type_number == PyramidTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+          this->writeBoundaryAdjacencyPerElementRawBinary<PyramidTrait<SimulationControl::kPolynomialOrder>>(
+              solver.pyramid_, adjacency_raw_binary, parent_index_each_type, adjacency_sequence_in_parent);
+        }
+      } else if constexpr (AdjacencyElementTrait::kElementType == ElementEnum::Quadrangle) {
+        if (parent_gmsh_type_number == PyramidTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+          this->writeBoundaryAdjacencyPerElementRawBinary<PyramidTrait<SimulationControl::kPolynomialOrder>>(
+              solver.pyramid_, adjacency_raw_binary, parent_index_each_type, adjacency_sequence_in_parent);
+        } else if (parent_gmsh_type_number == HexahedronTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+          this->writeBoundaryAdjacencyPerElementRawBinary<HexahedronTrait<SimulationControl::kPolynomialOrder>>(
+              solver.hexahedron_, adjacency_raw_binary, parent_index_each_type, adjacency_sequence_in_parent);
+        }
       }
     }
-  }
+  });
 }
 
 template <typename SimulationControl>
-inline void Solver<SimulationControl>::writeRawBinary(const Mesh<SimulationControl>& mesh,
-                                                      const std::filesystem::path& raw_binary_path) {
+inline void Solver<SimulationControl>::packRawBinary(const Mesh<SimulationControl>& mesh, const bool is_compact,
+                                                     std::vector<char>& raw_binary) const {
+  std::size_t raw_binary_offset = 0;
   if constexpr (SimulationControl::kDimension == 1) {
-    this->line_.writeElementRawBinary(this->raw_binary_ss_);
-    this->point_.writeBoundaryAdjacencyElementRawBinary(mesh.point_, *this, this->raw_binary_ss_);
+    this->line_.writeElementRawBinary(is_compact, raw_binary, raw_binary_offset);
+    if (!is_compact) {
+      this->point_.writeBoundaryAdjacencyElementRawBinary(mesh.point_, *this, raw_binary, raw_binary_offset);
+    }
   } else if constexpr (SimulationControl::kDimension == 2) {
     if constexpr (HasTriangle<SimulationControl::kMeshModel>) {
-      this->triangle_.writeElementRawBinary(this->raw_binary_ss_);
+      this->triangle_.writeElementRawBinary(is_compact, raw_binary, raw_binary_offset);
     }
     if constexpr (HasQuadrangle<SimulationControl::kMeshModel>) {
-      this->quadrangle_.writeElementRawBinary(this->raw_binary_ss_);
+      this->quadrangle_.writeElementRawBinary(is_compact, raw_binary, raw_binary_offset);
+    }
+    if (!is_compact) {
+      this->line_.writeBoundaryAdjacencyElementRawBinary(mesh.line_, *this, raw_binary, raw_binary_offset);
     }
-    this->line_.writeBoundaryAdjacencyElementRawBinary(mesh.line_, *this, this->raw_binary_ss_);
   } else if constexpr (SimulationControl::kDimension == 3) {
     if constexpr (HasTetrahedron<SimulationControl::kMeshModel>) {
-      this->tetrahedron_.writeElementRawBinary(this->raw_binary_ss_);
+      this->tetrahedron_.writeElementRawBinary(is_compact, raw_binary, raw_binary_offset);
     }
     if constexpr (HasPyramid<SimulationControl::kMeshModel>) {
-      this->pyramid_.writeElementRawBinary(this->raw_binary_ss_);
+      this->pyramid_.writeElementRawBinary(is_compact, raw_binary, raw_binary_offset);
     }
     if constexpr (HasHexahedron<SimulationControl::kMeshModel>) {
-      this->hexahedron_.writeElementRawBinary(this->raw_binary_ss_);
+      this->hexahedron_.writeElementRawBinary(is_compact, raw_binary, raw_binary_offset);
     }
     if constexpr (HasAdjacencyTriangle<SimulationControl::kMeshModel>) {
-      this->triangle_.writeBoundaryAdjacencyElementRawBinary(mesh.triangle_, *this, this->raw_binary_ss_);
+      if (!is_compact) {
+        this->triangle_.writeBoundaryAdjacencyElementRawBinary(mesh.triangle_, *this, raw_binary, raw_binary_offset);
+      }
     }
     if constexpr (HasAdjacencyQuadrangle<SimulationControl::kMeshModel>) {
-      this->quadrangle_.writeBoundaryAdjacencyElementRawBinary(mesh.quadrangle_, *this, this->raw_binary_ss_);
+      if (!is_compact) {
+        this->quadrangle_.writeBoundaryAdjacencyElementRawBinary(mesh.quadrangle_, *this, raw_binary,
+                                                                 raw_binary_offset);
+      }
     }
   }
-  this->raw_binary_ss_.write(reinterpret_cast<const char*>(this->node_artificial_viscosity_.data()),
-                             mesh.node_number_ * kRealSize);
-  this->write_raw_binary_future_ =
-      std::async(std::launch::async, RawBinaryCompress::write, raw_binary_path, std::ref(this->raw_binary_ss_));
+  if (is_compact) {
+    raw_binary.resize(raw_binary_offset);
+    return;
+  }
+  raw_binary.resize(raw_binary_offset + static_cast<std::size_t>(mesh.node_number_ * kRealSize));
+  std::memcpy(raw_binary.data() + raw_binary_offset, this->node_artificial_viscosity_.data(),
+              static_cast<std::size_t>(mesh.node_number_ * kRealSize));
+}
+
+template <typename SimulationControl>
+inline void Solver<SimulationControl>::unpackRawBinary(const bool is_compact, const std::vector<char>& raw_binary) {
+  std::size_t raw_binary_offset = 0;
+  if constexpr (SimulationControl::kDimension == 1) {
+    this->line_.readElementRawBinary(is_compact, raw_binary, raw_binary_offset);
+  } else if constexpr (SimulationControl::kDimension == 2) {
+    if constexpr (HasTriangle<SimulationControl::kMeshModel>) {
+      this->triangle_.readElementRawBinary(is_compact, raw_binary, raw_binary_offset);
+    }
+    if constexpr (HasQuadrangle<SimulationControl::kMeshModel>) {
+      this->quadrangle_.readElementRawBinary(is_compact, raw_binary, raw_binary_offset);
+    }
+  } else if constexpr (SimulationControl::kDimension == 3) {
+    if constexpr (HasTetrahedron<SimulationControl::kMeshModel>) {
+      this->tetrahedron_.readElementRawBinary(is_compact, raw_binary, raw_binary_offset);
+    }
+    if constexpr (HasPyramid<SimulationControl::kMeshModel>) {
+      this->pyramid_.readElementRawBinary(is_compact, raw_binary, raw_binary_offset);
+    }
+    if constexpr (HasHexahedron<SimulationControl::kMeshModel>) {
+      this->hexahedron_.readElementRawBinary(is_compact, raw_binary, raw_binary_offset);
+    }
+  }
+}
+
+template <typename SimulationControl>
+inline void Solver<SimulationControl>::writeRawBinary(const Mesh<SimulationControl>& mesh,
+                                                      const TimeIntegration<SimulationControl>& time_integration,
+                                                      const std::filesystem::path& raw_binary_path,
+                                                      const bool is_checkpoint) {
+  if (is_checkpoint || !this->raw_binary_quantize_) {
+    const RawBinaryTypeEnum raw_binary_type =
+        this->raw_binary_compact_ ? RawBinaryTypeEnum::Compact : RawBinaryTypeEnum::Full;
+    getRawBinaryBlock(mesh, raw_binary_type, this->raw_binary_block_);
+    getRawBinaryHeader(mesh, time_integration, raw_binary_type, this->raw_binary_header_);
+    this->packRawBinary(mesh, this->raw_binary_compact_, this->raw_binary_);
+    this->deltaRawBinary(this->raw_binary_);
+    this->raw_binary_write_queue_.push(raw_binary_path, this->raw_binary_header_, this->raw_binary_block_,
+                                       this->raw_binary_);
+    return;
+  }
+  std::vector<Isize> element_row_number{SimulationControl::kConservedVariableNumber};
+  if constexpr (IsNS<SimulationControl::kEquationModel>) {
+    element_row_number.emplace_back(SimulationControl::kConservedVariableNumber * SimulationControl::kDimension);
+  }
+  getRawBinaryBlock(mesh, RawBinaryTypeEnum::Full, this->raw_binary_block_);
+  getRawBinaryBlock(mesh, RawBinaryTypeEnum::Quantized, this->raw_binary_quantized_block_);
+  getRawBinaryHeader(mesh, time_integration, RawBinaryTypeEnum::Quantized, this->raw_binary_header_);
+  this->packRawBinary(mesh, false, this->raw_binary_);
+  quantizeRawBinary(this->raw_binary_block_, this->raw_binary_, this->raw_binary_quantized_block_, element_row_number,
+                    this->raw_binary_quantize_tolerance_, this->raw_binary_quantized_);
+  this->deltaRawBinary(this->raw_binary_quantized_);
+  this->raw_binary_write_queue_.push(raw_binary_path, this->raw_binary_header_, this->raw_binary_quantized_block_,
+                                     this->raw_binary_quantized_);
+}
+
+// NOTE: A snapshot becomes a keyframe every keyframe interval snapshots and whenever its type differs from the previous
+// one, all others are written as the delta against the previous snapshot.
+template <typename SimulationControl>
+inline void Solver<SimulationControl>::deltaRawBinary(std::vector<char>& raw_binary) {
+  if (this->raw_binary_keyframe_interval_ <= 0) {
+    return;
+  }
+  if (this->raw_binary_delta_number_ > 0 && this->raw_binary_delta_number_ < this->raw_binary_keyframe_interval_ &&
+      this->raw_binary_reference_header_.type_ == this->raw_binary_header_.type_ &&
+      this->raw_binary_reference_.size() == raw_binary.size()) {
+    this->raw_binary_header_.reference_iteration_ = this->raw_binary_reference_header_.iteration_;
+    this->raw_binary_header_.keyframe_iteration_ = this->raw_binary_reference_header_.keyframe_iteration_;
+    encodeRawBinaryDelta(this->raw_binary_reference_, raw_binary);
+    this->raw_binary_delta_number_++;
+  } else {
+    this->raw_binary_reference_ = raw_binary;
+    this->raw_binary_delta_number_ = 1;
+  }
+  this->raw_binary_reference_header_ = this->raw_binary_header_;
+}
+
+// NOTE: The gradient and the artificial viscosity of a compact snapshot are recomputed with the same passes the solver
+// uses in a step, then the full snapshot is packed back into the same buffer.
+template <typename SimulationControl>
+inline void Solver<SimulationControl>::rebuildRawBinary(
+    const Mesh<SimulationControl>& mesh, [[maybe_unused]] const PhysicalModel<SimulationControl>& physical_model,
+    [[maybe_unused]] const BoundaryCondition<SimulationControl>& boundary_condition,
+    [[maybe_unused]] const TimeIntegration<SimulationControl>& time_integration, std::vector<char>& raw_binary) {
+  this->unpackRawBinary(true, raw_binary);
+  if constexpr (SimulationControl::kBoundaryTime == BoundaryTimeEnum::TimeVarying) {
+    this->updateBoundaryVariable(mesh, physical_model, boundary_condition, time_integration);
+  }
+  if constexpr (SimulationControl::kShockCapturing == ShockCapturingEnum::ArtificialViscosity) {
+    this->calculateArtificialViscosity(mesh);
+  }
+  if constexpr (IsNS<SimulationControl::kEquationModel>) {
+    this->calculateGardientQuadrature(mesh, physical_model);
+    this->calculateAdjacencyGardientQuadrature(mesh, physical_model, boundary_condition);
+    this->calculateGardientResidual(mesh);
+    this->updateGardientBasisFunctionCoefficient(mesh);
+  }
+  this->packRawBinary(mesh, false, raw_binary);
 }
 
 template <typename ElementTrait, typename SimulationControl>
 inline void ElementViewSolver<ElementTrait, SimulationControl>::calcluateElementViewVariable(
     const ElementMesh<ElementTrait>& element_mesh, const PhysicalModel<SimulationControl>& physical_model,
-    const Eigen::Vector<Real, Eigen::Dynamic>& node_artificial_viscosity, std::stringstream& raw_binary_ss) {
-  if constexpr (IsEuler<SimulationControl::kEquationModel>) {
-    Eigen::Matrix<Real, SimulationControl::kConservedVariableNumber, ElementTrait::kBasisFunctionNumber>
-        variable_basis_function_coefficient;
-    Eigen::Vector<Real, ElementTrait::kBasicNodeNumber> variable_artificial_viscosity;
-    for (Isize i = 0; i < element_mesh.number_; i++) {
-      raw_binary_ss.read(reinterpret_cast<char*>(variable_basis_function_coefficient.data()),
-                         SimulationControl::kConservedVariableNumber * ElementTrait::kBasisFunctionNumber * kRealSize);
-      this->view_variable_(i).variable_.conserved_.noalias() =
-          variable_basis_function_coefficient * this->basis_function_.modal_value_;
-      this->view_variable_(i).variable_.calculateComputationalFromConserved(physical_model);
-      for (Isize j = 0; j < ElementTrait::kBasicNodeNumber; j++) {
-        variable_artificial_viscosity(j) = node_artificial_viscosity(element_mesh.element_(i).node_tag_(j) - 1);
-      }
-      this->view_variable_(i).artificial_viscosity_.noalias() =
-          this->basis_function_.nodal_value_.transpose() * variable_artificial_viscosity;
-    }
-  }
+    const Eigen::Map<const Eigen::Vector<Real, Eigen::Dynamic>>& node_artificial_viscosity,
+    const std::vector<char>& raw_binary, const Isize element_index,
+    ViewVariable<ElementTrait, SimulationControl>& view_variable) const {
+  constexpr std::size_t kElementRawBinarySize{getElementRawBinarySize<ElementTrait, SimulationControl>()};
+  const Real* element_raw_binary = reinterpret_cast<const Real*>(
+      raw_binary.data() + this->raw_binary_offset_ + static_cast<std::size_t>(element_index) * kElementRawBinarySize);
+  const Eigen::Map<
+      const Eigen::Matrix<Real, SimulationControl::kConservedVariableNumber, ElementTrait::kBasisFunctionNumber>>
+      variable_basis_function_coefficient(element_raw_binary);
+  view_variable.variable_.conserved_.noalias() =
+      variable_basis_function_coefficient * this->basis_function_.modal_value_;
+  view_variable.variable_.calculateComputationalFromConserved(physical_model);
   if constexpr (IsNS<SimulationControl::kEquationModel>) {
-    Eigen::Matrix<Real, SimulationControl::kConservedVariableNumber, ElementTrait::kBasisFunctionNumber>
-        variable_basis_function_coefficient;
-    Eigen::Matrix<Real, SimulationControl::kConservedVariableNumber * SimulationControl::kDimension,
-                  ElementTrait::kBasisFunctionNumber>
-        variable_gradient_basis_function_coefficient;
-    Eigen::Vector<Real, ElementTrait::kBasicNodeNumber> variable_artificial_viscosity;
-    for (Isize i = 0; i < element_mesh.number_; i++) {
-      raw_binary_ss.read(reinterpret_cast<char*>(variable_basis_function_coefficient.data()),
-                         SimulationControl::kConservedVariableNumber * ElementTrait::kBasisFunctionNumber * kRealSize);
-      raw_binary_ss.read(reinterpret_cast<char*>(variable_gradient_basis_function_coefficient.data()),
-                         SimulationControl::kConservedVariableNumber * SimulationControl::kDimension *
-                             ElementTrait::kBasisFunctionNumber * kRealSize);
-      this->view_variable_(i).variable_.conserved_.noalias() =
-          variable_basis_function_coefficient * this->basis_function_.modal_value_;
-      this->view_variable_(i).variable_.calculateComputationalFromConserved(physical_model);
-      this->view_variable_(i).variable_gradient_.conserved_.noalias() =
-          variable_gradient_basis_function_coefficient * this->basis_function_.modal_value_;
-      this->view_variable_(i).variable_gradient_.calculatePrimitiveFromConserved(physical_model,
-                                                                                 this->view_variable_(i).variable_);
-      for (Isize j = 0; j < ElementTrait::kBasicNodeNumber; j++) {
-        variable_artificial_viscosity(j) = node_artificial_viscosity(element_mesh.element_(i).node_tag_(j) - 1);
-      }
-      this->view_variable_(i).artificial_viscosity_.noalias() =
-          this->basis_function_.nodal_value_.transpose() * variable_artificial_viscosity;
-    }
+    const Eigen::Map<const Eigen::Matrix<Real,
+                                         SimulationControl::kConservedVariableNumber * SimulationControl::kDimension,
+                                         ElementTrait::kBasisFunctionNumber>>
+        variable_gradient_basis_function_coefficient(
+            element_raw_binary + SimulationControl::kConservedVariableNumber * ElementTrait::kBasisFunctionNumber);
+    view_variable.variable_gradient_.conserved_.noalias() =
+        variable_gradient_basis_function_coefficient * this->basis_function_.modal_value_;
+    view_variable.variable_gradient_.calculatePrimitiveFromConserved(physical_model, view_variable.variable_);
+  }
+  Eigen::Vector<Real, ElementTrait::kBasicNodeNumber> variable_artificial_viscosity;
+  for (Isize i = 0; i < ElementTrait::kBasicNodeNumber; i++) {
+    variable_artificial_viscosity(i) = node_artificial_viscosity(element_mesh.element_(element_index).node_tag_(i) - 1);
   }
+  view_variable.artificial_viscosity_.noalias() =
+      this->basis_function_.nodal_value_.transpose() * variable_artificial_viscosity;
 }
 
 template <typename AdjacencyElementTrait, typename SimulationControl>
@@ -245,49 +555,38 @@ template <typename ElementTrait>
 inline void
 AdjacencyElementViewSolver<AdjacencyElementTrait, SimulationControl>::calcluateAdjacencyPerElementViewVariable(
     const PhysicalModel<SimulationControl>& physical_model,
-    const ElementViewSolver<ElementTrait, SimulationControl>& element_view_solver, std::stringstream& raw_binary_ss,
-    const Isize adjacency_sequence_in_parent, const Isize parent_gmsh_type_number, const Isize column) {
+    const ElementViewSolver<ElementTrait, SimulationControl>& element_view_solver, const char* raw_binary,
+    const Isize adjacency_sequence_in_parent, const Isize parent_gmsh_type_number,
+    ViewVariable<AdjacencyElementTrait, SimulationControl>& view_variable) const {
   const std::array<
       int, getElementBasisFunctionNumber<AdjacencyElementTrait::kElementType, SimulationControl::kPolynomialOrder>()>
       adjacency_element_view_node_parent_sequence{
           getAdjacencyElementViewNodeParentSequence<AdjacencyElementTrait::kElementType,
                                                     SimulationControl::kPolynomialOrder>(
               static_cast<int>(parent_gmsh_type_number), static_cast<int>(adjacency_sequence_in_parent))};
-  if constexpr (IsEuler<SimulationControl::kEquationModel>) {
-    Eigen::Matrix<Real, SimulationControl::kConservedVariableNumber, ElementTrait::kBasisFunctionNumber>
-        variable_basis_function_coefficient;
-    raw_binary_ss.read(reinterpret_cast<char*>(variable_basis_function_coefficient.data()),
-                       SimulationControl::kConservedVariableNumber * ElementTrait::kBasisFunctionNumber * kRealSize);
-    for (Isize i = 0; i < AdjacencyElementTrait::kAllNodeNumber; i++) {
-      this->view_variable_(column).variable_.conserved_.col(i).noalias() =
-          variable_basis_function_coefficient * element_view_solver.basis_function_.modal_value_.col(
-                                                    adjacency_element_view_node_parent_sequence[static_cast<Usize>(i)]);
-    }
-    this->view_variable_(column).variable_.calculateComputationalFromConserved(physical_model);
+  const Eigen::Map<
+      const Eigen::Matrix<Real, SimulationControl::kConservedVariableNumber, ElementTrait::kBasisFunctionNumber>>
+      variable_basis_function_coefficient(reinterpret_cast<const Real*>(raw_binary));
+  for (Isize i = 0; i < AdjacencyElementTrait::kAllNodeNumber; i++) {
+    view_variable.variable_.conserved_.col(i).noalias() =
+        variable_basis_function_coefficient * element_view_solver.basis_function_.modal_value_.col(
+                                                  adjacency_element_view_node_parent_sequence[static_cast<Usize>(i)]);
   }
+  view_variable.variable_.calculateComputationalFromConserved(physical_model);
   if constexpr (IsNS<SimulationControl::kEquationModel>) {
-    Eigen::Matrix<Real, SimulationControl::kConservedVariableNumber, ElementTrait::kBasisFunctionNumber>
-        variable_basis_function_coefficient;
-    Eigen::Matrix<Real, SimulationControl::kConservedVariableNumber * SimulationControl::kDimension,
-                  ElementTrait::kBasisFunctionNumber>
-        variable_gradient_basis_function_coefficient;
-    raw_binary_ss.read(reinterpret_cast<char*>(variable_basis_function_coefficient.data()),
-                       SimulationControl::kConservedVariableNumber * ElementTrait::kBasisFunctionNumber * kRealSize);
-    raw_binary_ss.read(reinterpret_cast<char*>(variable_gradient_basis_function_coefficient.data()),
-                       SimulationControl::kConservedVariableNumber * SimulationControl::kDimension *
-                           ElementTrait::kBasisFunctionNumber * kRealSize);
+    const Eigen::Map<const Eigen::Matrix<Real,
+                                         SimulationControl::kConservedVariableNumber * SimulationControl::kDimension,
+                                         ElementTrait::kBasisFunctionNumber>>
+        variable_gradient_basis_function_coefficient(
+            reinterpret_cast<const Real*>(raw_binary) +
+            SimulationControl::kConservedVariableNumber * ElementTrait::kBasisFunctionNumber);
     for (Isize i = 0; i < AdjacencyElementTrait::kAllNodeNumber; i++) {
-      this->view_variable_(column).variable_.conserved_.col(i).noalias() =
-          variable_basis_function_coefficient * element_view_solver.basis_function_.modal_value_.col(
-                                                    adjacency_element_view_node_parent_sequence[static_cast<Usize>(i)]);
-      this->view_variable_(column).variable_gradient_.conserved_.col(i).noalias() =
+      view_variable.variable_gradient_.conserved_.col(i).noalias() =
           variable_gradient_basis_function_coefficient *
           element_view_solver.basis_function_.modal_value_.col(
               adjacency_element_view_node_parent_sequence[static_cast<Usize>(i)]);
     }
-    this->view_variable_(column).variable_.calculateComputationalFromConserved(physical_model);
-    this->view_variable_(column).variable_gradient_.calculatePrimitiveFromConserved(
-        physical_model, this->view_variable_(column).variable_);
+    view_variable.variable_gradient_.calculatePrimitiveFromConserved(physical_model, view_variable.variable_);
   }
 }
 
@@ -295,132 +594,109 @@ template <typename AdjacencyElementTrait, typename SimulationControl>
 inline void AdjacencyElementViewSolver<AdjacencyElementTrait, SimulationControl>::calcluateAdjacencyElementViewVariable(
     const AdjacencyElementMesh<AdjacencyElementTrait>& adjacency_element_mesh,
     const PhysicalModel<SimulationControl>& physical_model, const ViewSolver<SimulationControl>& view_solver,
-    const Eigen::Vector<Real, Eigen::Dynamic>& node_artificial_viscosity, std::stringstream& raw_binary_ss) {
-  Eigen::Vector<Real, AdjacencyElementTrait::kBasicNodeNumber> variable_artificial_viscosity;
-  for (Isize i = 0; i < adjacency_element_mesh.boundary_number_; i++) {
-    const Isize adjacency_sequence_in_parent =
-        adjacency_element_mesh.element_(i + adjacency_element_mesh.interior_number_).adjacency_sequence_in_parent_(0);
-    const Isize parent_gmsh_type_number =
-        adjacency_element_mesh.element_(i + adjacency_element_mesh.interior_number_).parent_gmsh_type_number_(0);
-    if constexpr (AdjacencyElementTrait::kElementType == ElementEnum::Point) {
-      this->calcluateAdjacencyPerElementViewVariable<LineTrait<SimulationControl::kPolynomialOrder>>(
-          physical_model, view_solver.line_, raw_binary_ss, adjacency_sequence_in_parent, parent_gmsh_type_number, i);
-    } else if constexpr (AdjacencyElementTrait::kElementType == ElementEnum::Line) {
-      if (parent_gmsh_type_number == TriangleTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
-        this->calcluateAdjacencyPerElementViewVariable<TriangleTrait<SimulationControl::kPolynomialOrder>>(
-            physical_model, view_solver.triangle_, raw_binary_ss, adjacency_sequence_in_parent, parent_gmsh_type_number,
-            i);
-      } else if (parent_gmsh_type_number == QuadrangleTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
-        this->calcluateAdjacencyPerElementViewVariable<QuadrangleTrait<SimulationControl::kPolynomialOrder>>(
-            physical_model, view_solver.quadrangle_, raw_binary_ss, adjacency_sequence_in_parent,
-            parent_gmsh_type_number, i);
-      }
-    } else if constexpr (AdjacencyElementTrait::kElementType == ElementEnum::Triangle) {
-      if (parent_gmsh_type_number == TetrahedronTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
-        this->calcluateAdjacencyPerElementViewVariable<TetrahedronTrait<SimulationControl::kPolynomialOrder>>(
-            physical_model, view_solver.tetrahedron_, raw_binary_ss, adjacency_sequence_in_parent,
-            parent_gmsh_type_number, i);
-      } else if (parent_gmsh_type_number == PyramidTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
-        this->calcluateAdjacencyPerElementViewVariable<PyramidTrait<SimulationControl::kPolynomialOrder>>(
-            physical_model, view_solver.pyramid_, raw_binary_ss, adjacency_sequence_in_parent, parent_gmsh_type_number,
-            i);
-      }
-    } else if constexpr (AdjacencyElementTrait::kElementType == ElementEnum::Quadrangle) {
-      if (parent_gmsh_type_number == PyramidTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
-        this->calcluateAdjacencyPerElementViewVariable<PyramidTrait<SimulationControl::kPolynomialOrder>>(
-            physical_model, view_solver.pyramid_, raw_binary_ss, adjacency_sequence_in_parent, parent_gmsh_type_number,
-            i);
-      } else if (parent_gmsh_type_number == HexahedronTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
-        this->calcluateAdjacencyPerElementViewVariable<HexahedronTrait<SimulationControl::kPolynomialOrder>>(
-            physical_model, view_solver.hexahedron_, raw_binary_ss, adjacency_sequence_in_parent,
-            parent_gmsh_type_number, i);
-      }
+    const Eigen::Map<const Eigen::Vector<Real, Eigen::Dynamic>>& node_artificial_viscosity,
+    const std::vector<char>& raw_binary, const Isize element_index,
+    ViewVariable<AdjacencyElementTrait, SimulationControl>& view_variable) const {
+  const Isize adjacency_sequence_in_parent =
+      adjacency_element_mesh.element_(element_index).adjacency_sequence_in_parent_(0);
+  const Isize parent_gmsh_type_number = adjacency_element_mesh.element_(element_index).parent_gmsh_type_number_(0);
+  const char* adjacency_raw_binary =
+      raw_binary.data() +
+      this->raw_binary_offset_[static_cast<Usize>(element_index - adjacency_element_mesh.interior_number_)];
+  if constexpr (AdjacencyElementTrait::kElementType == ElementEnum::Point) {
+    this->calcluateAdjacencyPerElementViewVariable<LineTrait<SimulationControl::kPolynomialOrder>>(
+        physical_model, view_solver.line_, adjacency_raw_binary, adjacency_sequence_in_parent,
+        parent_gmsh_type_number, view_variable);
+  } else if constexpr (AdjacencyElementTrait::kElementType == ElementEnum::Line) {
+    if (parent_gmsh_type_number == TriangleTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+      this->calcluateAdjacencyPerElementViewVariable<TriangleTrait<SimulationControl::kPolynomialOrder>>(
+          physical_model, view_solver.triangle_, adjacency_raw_binary, adjacency_sequence_in_parent,
+          parent_gmsh_type_number, view_variable);
+    } else if (parent_gmsh_type_number == QuadrangleTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+      this->calcluateAdjacencyPerElementViewVariable<QuadrangleTrait<SimulationControl::kPolynomialOrder>>(
+          physical_model, view_solver.quadrangle_, adjacency_raw_binary, adjacency_sequence_in_parent,
+          parent_gmsh_type_number, view_variable);
+    }
+  } else if constexpr (AdjacencyElementTrait::kElementType == ElementEnum::Triangle) {
+    if (parent_gmsh_type_number == TetrahedronTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+      this->calcluateAdjacencyPerElementViewVariable<TetrahedronTrait<SimulationControl::kPolynomialOrder>>(
+          physical_model, view_solver.tetrahedron_, adjacency_raw_binary, adjacency_sequence_in_parent,
+          parent_gmsh_type_number, view_variable);
+    } else if (parent_gmsh_type_number == PyramidTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+      this->calcluateAdjacencyPerElementViewVariable<PyramidTrait<SimulationControl::kPolynomialOrder>>(
+          physical_model, view_solver.pyramid_, adjacency_raw_binary, adjacency_sequence_in_parent,
+          parent_gmsh_type_number, view_variable);
     }
-    for (Isize j = 0; j < AdjacencyElementTrait::kBasicNodeNumber; j++) {
-      variable_artificial_viscosity(j) = node_artificial_viscosity(adjacency_element_mesh.element_(i).node_tag_(j) - 1);
+  } else if constexpr (AdjacencyElementTrait::kElementType == ElementEnum::Quadrangle) {
+    if (parent_gmsh_type_number == PyramidTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+      this->calcluateAdjacencyPerElementViewVariable<PyramidTrait<SimulationControl::kPolynomialOrder>>(
+          physical_model, view_solver.pyramid_, adjacency_raw_binary, adjacency_sequence_in_parent,
+          parent_gmsh_type_number, view_variable);
+    } else if (parent_gmsh_type_number == HexahedronTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+      this->calcluateAdjacencyPerElementViewVariable<HexahedronTrait<SimulationControl::kPolynomialOrder>>(
+          physical_model, view_solver.hexahedron_, adjacency_raw_binary, adjacency_sequence_in_parent,
+          parent_gmsh_type_number, view_variable);
     }
-    this->view_variable_(i).artificial_viscosity_.noalias() =
-        this->basis_function_.nodal_value_.transpose() * variable_artificial_viscosity;
   }
+  Eigen::Vector<Real, AdjacencyElementTrait::kBasicNodeNumber> variable_artificial_viscosity;
+  for (Isize i = 0; i < AdjacencyElementTrait::kBasicNodeNumber; i++) {
+    variable_artificial_viscosity(i) =
+        node_artificial_viscosity(adjacency_element_mesh.element_(element_index).node_tag_(i) - 1);
+  }
+  view_variable.artificial_viscosity_.noalias() =
+      this->basis_function_.nodal_value_.transpose() * variable_artificial_viscosity;
 }
 
-template <typename SimulationControl>
-inline void ViewSolver<SimulationControl>::calcluateViewVariable(const Mesh<SimulationControl>& mesh,
-                                                                 const PhysicalModel<SimulationControl>& physical_model,
-                                                                 const std::filesystem::path& raw_binary_path,
-                                                                 std::stringstream& raw_binary_ss) {
-  RawBinaryCompress::read(raw_binary_path, raw_binary_ss);
-  Eigen::Vector<Real, Eigen::Dynamic> node_artificial_viscosity(mesh.node_number_);
-  raw_binary_ss.seekg(-mesh.node_number_ * kRealSize, std::ios::end);
-  raw_binary_ss.read(reinterpret_cast<char*>(node_artificial_viscosity.data()), mesh.node_number_ * kRealSize);
-  raw_binary_ss.seekg(0, std::ios::beg);
-  if constexpr (SimulationControl::kDimension == 1) {
-    this->line_.calcluateElementViewVariable(mesh.line_, physical_model, node_artificial_viscosity, raw_binary_ss);
-    this->point_.calcluateAdjacencyElementViewVariable(mesh.point_, physical_model, *this, node_artificial_viscosity,
-                                                       raw_binary_ss);
-  } else if constexpr (SimulationControl::kDimension == 2) {
-    if constexpr (HasTriangle<SimulationControl::kMeshModel>) {
-      this->triangle_.calcluateElementViewVariable(mesh.triangle_, physical_model, node_artificial_viscosity,
-                                                   raw_binary_ss);
-    }
-    if constexpr (HasQuadrangle<SimulationControl::kMeshModel>) {
-      this->quadrangle_.calcluateElementViewVariable(mesh.quadrangle_, physical_model, node_artificial_viscosity,
-                                                     raw_binary_ss);
-    }
-    this->line_.calcluateAdjacencyElementViewVariable(mesh.line_, physical_model, *this, node_artificial_viscosity,
-                                                      raw_binary_ss);
-  } else if constexpr (SimulationControl::kDimension == 3) {
-    if constexpr (HasTetrahedron<SimulationControl::kMeshModel>) {
-      this->tetrahedron_.calcluateElementViewVariable(mesh.tetrahedron_, physical_model, node_artificial_viscosity,
-                                                      raw_binary_ss);
-    }
-    if constexpr (HasPyramid<SimulationControl::kMeshModel>) {
-      this->pyramid_.calcluateElementViewVariable(mesh.pyramid_, physical_model, node_artificial_viscosity,
-                                                  raw_binary_ss);
-    }
-    if constexpr (HasHexahedron<SimulationControl::kMeshModel>) {
-      this->hexahedron_.calcluateElementViewVariable(mesh.hexahedron_, physical_model, node_artificial_viscosity,
-                                                     raw_binary_ss);
-    }
-    if constexpr (HasAdjacencyTriangle<SimulationControl::kMeshModel>) {
-      this->triangle_.calcluateAdjacencyElementViewVariable(mesh.triangle_, physical_model, *this,
-                                                            node_artificial_viscosity, raw_binary_ss);
-    }
-    if constexpr (HasAdjacencyQuadrangle<SimulationControl::kMeshModel>) {
-      this->quadrangle_.calcluateAdjacencyElementViewVariable(mesh.quadrangle_, physical_model, *this,
-                                                              node_artificial_viscosity, raw_binary_ss);
-    }
+template <typename ElementTrait, typename SimulationControl>
+inline void ElementViewSolver<ElementTrait, SimulationControl>::initialElementViewSolver(
+    const ElementMesh<ElementTrait>& element_mesh, std::size_t& raw_binary_offset) {
+  this->raw_binary_offset_ = raw_binary_offset;
+  raw_binary_offset += static_cast<std::size_t>(element_mesh.number_) *
+                       getElementRawBinarySize<ElementTrait, SimulationControl>();
+}
+
+template <typename AdjacencyElementTrait, typename SimulationControl>
+inline void AdjacencyElementViewSolver<AdjacencyElementTrait, SimulationControl>::initialAdjacencyElementViewSolver(
+    const AdjacencyElementMesh<AdjacencyElementTrait>& adjacency_element_mesh, std::size_t& raw_binary_offset) {
+  this->raw_binary_offset_.resize(static_cast<Usize>(adjacency_element_mesh.boundary_number_));
+  for (Isize i = 0; i < adjacency_element_mesh.boundary_number_; i++) {
+    this->raw_binary_offset_[static_cast<Usize>(i)] = raw_binary_offset;
+    raw_binary_offset += getAdjacencyParentElementRawBinarySize<AdjacencyElementTrait, SimulationControl>(
+        adjacency_element_mesh.element_(i + adjacency_element_mesh.interior_number_).parent_gmsh_type_number_(0));
   }
 }
 
+// NOTE: Only the offsets of the full snapshot layout are kept here, the view variables are evaluated element by element
+// when the fields are written, so one solver is shared by every snapshot in flight.
 template <typename SimulationControl>
 inline void ViewSolver<SimulationControl>::initialViewSolver(const Mesh<SimulationControl>& mesh) {
+  std::size_t raw_binary_offset = 0;
   if constexpr (SimulationControl::kDimension == 1) {
-    this->line_.view_variable_.resize(mesh.line_.number_);
-    this->point_.view_variable_.resize(mesh.point_.boundary_number_);
+    this->line_.initialElementViewSolver(mesh.line_, raw_binary_offset);
+    this->point_.initialAdjacencyElementViewSolver(mesh.point_, raw_binary_offset);
   } else if constexpr (SimulationControl::kDimension == 2) {
     if constexpr (HasTriangle<SimulationControl::kMeshModel>) {
-      this->triangle_.view_variable_.resize(mesh.triangle_.number_);
+      this->triangle_.initialElementViewSolver(mesh.triangle_, raw_binary_offset);
     }
     if constexpr (HasQuadrangle<SimulationControl::kMeshModel>) {
-      this->quadrangle_.view_variable_.resize(mesh.quadrangle_.number_);
+      this->quadrangle_.initialElementViewSolver(mesh.quadrangle_, raw_binary_offset);
     }
-    this->line_.view_variable_.resize(mesh.line_.boundary_number_);
+    this->line_.initialAdjacencyElementViewSolver(mesh.line_, raw_binary_offset);
   } else if constexpr (SimulationControl::kDimension == 3) {
     if constexpr (HasTetrahedron<SimulationControl::kMeshModel>) {
-      this->tetrahedron_.view_variable_.resize(mesh.tetrahedron_.number_);
+      this->tetrahedron_.initialElementViewSolver(mesh.tetrahedron_, raw_binary_offset);
     }
     if constexpr (HasPyramid<SimulationControl::kMeshModel>) {
-      this->pyramid_.view_variable_.resize(mesh.pyramid_.number_);
+      this->pyramid_.initialElementViewSolver(mesh.pyramid_, raw_binary_offset);
     }
     if constexpr (HasHexahedron<SimulationControl::kMeshModel>) {
-      this->hexahedron_.view_variable_.resize(mesh.hexahedron_.number_);
+      this->hexahedron_.initialElementViewSolver(mesh.hexahedron_, raw_binary_offset);
     }
     if constexpr (HasAdjacencyTriangle<SimulationControl::kMeshModel>) {
-      this->triangle_.view_variable_.resize(mesh.triangle_.boundary_number_);
+      this->triangle_.initialAdjacencyElementViewSolver(mesh.triangle_, raw_binary_offset);
     }
     if constexpr (HasAdjacencyQuadrangle<SimulationControl::kMeshModel>) {
-      this->quadrangle_.view_variable_.resize(mesh.quadrangle_.boundary_number_);
+      this->quadrangle_.initialAdjacencyElementViewSolver(mesh.quadrangle_, raw_binary_offset);
     }
   }
 }
@@ -0,0 +1,609 @@
+/**
+ * @file RawBinaryCompress.cpp
+ * @brief The header file of SubrosaDG raw binary compress.
+ *
+ * @author Yufei.Liu, Calm.Liu@outlook.com | Chenyu.Bao, bcynuaa@163.com
+ * @date 2025-04-09
+ *
+ * @version 0.1.0
+ * @copyright Copyright (c) 2022 - 2025 by SubrosaDG developers. All rights reserved.
+ * SubrosaDG is free software and is distributed under the MIT license.
+ */
+
+#ifndef SUBROSA_DG_RAW_BINARY_COMPRESS_CPP_
+#define SUBROSA_DG_RAW_BINARY_COMPRESS_CPP_
+
+#include <fcntl.h>
+#include <oneapi/tbb.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <zstd.h>
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <magic_enum/magic_enum.hpp>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Utils/BasicDataType.cpp"
+#include "Utils/Concept.cpp"
+#include "Utils/Constant.cpp"
+#include "Utils/Enum.cpp"
+#include "Utils/ParallelControl.cpp"
+
+namespace SubrosaDG {
+
+inline constexpr std::size_t kRawBinaryChunkSize{static_cast<std::size_t>(1) << 22};
+
+// NOTE: A compact snapshot only keeps the conserved basis function coefficients, everything else is rebuilt from them.
+template <typename ElementTrait, typename SimulationControl>
+inline constexpr std::size_t getElementRawBinarySize(const bool is_compact = false) {
+  if (IsNS<SimulationControl::kEquationModel> && !is_compact) {
+    return static_cast<std::size_t>(SimulationControl::kConservedVariableNumber * ElementTrait::kBasisFunctionNumber *
+                                    (SimulationControl::kDimension + 1) * kRealSize);
+  } else {
+    return static_cast<std::size_t>(SimulationControl::kConservedVariableNumber * ElementTrait::kBasisFunctionNumber *
+                                    kRealSize);
+  }
+}
+
+inline constexpr std::array<char, 8> kRawBinaryMagic{'S', 'U', 'B', 'R', 'O', 'S', 'A', 'D'};
+inline constexpr std::uint32_t kRawBinaryVersion{3};
+
+// NOTE: The file starts with the header, followed by the block table and then the compressed blocks. Offsets in the
+// block table are byte offsets into the uncompressed snapshot and into the file, so a reader can fetch single blocks.
+// A delta snapshot stores the XOR against the snapshot at reference_iteration_, a keyframe has no reference.
+struct RawBinaryHeader {
+  std::array<char, 8> magic_{kRawBinaryMagic};
+  std::uint32_t version_{kRawBinaryVersion};
+  std::uint32_t block_number_{0};
+  std::int32_t real_size_{0};
+  std::int32_t dimension_{0};
+  std::int32_t polynomial_order_{0};
+  std::int32_t equation_model_{0};
+  std::int32_t conserved_variable_number_{0};
+  std::int32_t node_number_{0};
+  std::int32_t iteration_{0};
+  std::int32_t type_{0};
+  std::int32_t reference_iteration_{-1};
+  std::int32_t keyframe_iteration_{-1};
+  double time_{0.0};
+  double delta_time_{0.0};
+};
+
+struct RawBinaryBlock {
+  std::int32_t type_{0};
+  std::int32_t gmsh_type_number_{0};
+  std::int32_t number_{0};
+  std::int32_t shuffle_size_{0};
+  std::uint64_t offset_{0};
+  std::uint64_t size_{0};
+  std::uint64_t compressed_offset_{0};
+  std::uint64_t compressed_size_{0};
+  std::uint64_t checksum_{0};
+};
+
+// NOTE: The checksum of a block folds the checksums of its chunks in order, so it is computed chunk by chunk next to
+// the parallel compression and decompression.
+inline std::uint64_t getRawBinaryChecksum(const char* data, const std::size_t size) {
+  constexpr std::uint64_t kPrime1{0x9E3779B185EBCA87ULL};
+  constexpr std::uint64_t kPrime2{0xC2B2AE3D27D4EB4FULL};
+  std::uint64_t checksum = kPrime1 ^ static_cast<std::uint64_t>(size);
+  std::size_t i = 0;
+  for (; i + sizeof(std::uint64_t) <= size; i += sizeof(std::uint64_t)) {
+    std::uint64_t word;
+    std::memcpy(&word, data + i, sizeof(std::uint64_t));
+    checksum = std::rotl(checksum ^ (word * kPrime2), 31) * kPrime1;
+  }
+  for (; i < size; i++) {
+    checksum = std::rotl(checksum ^ (static_cast<std::uint64_t>(static_cast<unsigned char>(data[i])) * kPrime2), 31) *
+               kPrime1;
+  }
+  return checksum;
+}
+
+// NOTE: Group the n-th byte of every value together, the exponent and high mantissa bytes of neighbouring values are
+// close to each other and zstd finds much longer matches in them.
+inline void shuffleRawBinary(const char* raw_binary, const std::size_t size, const std::size_t shuffle_size,
+                             char* shuffled_raw_binary) {
+  const std::size_t value_number = size / shuffle_size;
+  for (std::size_t i = 0; i < shuffle_size; i++) {
+    for (std::size_t j = 0; j < value_number; j++) {
+      shuffled_raw_binary[i * value_number + j] = raw_binary[j * shuffle_size + i];
+    }
+  }
+  std::memcpy(shuffled_raw_binary + value_number * shuffle_size, raw_binary + value_number * shuffle_size,
+              size - value_number * shuffle_size);
+}
+
+inline void unshuffleRawBinary(const char* shuffled_raw_binary, const std::size_t size, const std::size_t shuffle_size,
+                               char* raw_binary) {
+  const std::size_t value_number = size / shuffle_size;
+  for (std::size_t i = 0; i < shuffle_size; i++) {
+    for (std::size_t j = 0; j < value_number; j++) {
+      raw_binary[j * shuffle_size + i] = shuffled_raw_binary[i * value_number + j];
+    }
+  }
+  std::memcpy(raw_binary + value_number * shuffle_size, shuffled_raw_binary + value_number * shuffle_size,
+              size - value_number * shuffle_size);
+}
+
+// NOTE: Each element is made of column-major matrices with one column per mode and the given row numbers, a mode is
+// dropped when it is below tolerance times the largest mode of the same row, so the error of each dropped coefficient
+// is bounded by that value. Everything is then stored in single precision.
+inline void quantizeRawBinary(const std::vector<RawBinaryBlock>& block, const std::vector<char>& raw_binary,
+                              const std::vector<RawBinaryBlock>& quantized_block,
+                              const std::vector<Isize>& element_row_number, const Real tolerance,
+                              std::vector<char>& quantized_raw_binary) {
+  quantized_raw_binary.resize(quantized_block.back().offset_ + quantized_block.back().size_);
+  Isize element_row_sum = 0;
+  for (const Isize row_number : element_row_number) {
+    element_row_sum += row_number;
+  }
+  for (std::size_t i = 0; i < block.size(); i++) {
+    const auto value_number = static_cast<Isize>(block[i].size_ / sizeof(Real));
+    const Real* value = reinterpret_cast<const Real*>(raw_binary.data() + block[i].offset_);
+    float* quantized_value = reinterpret_cast<float*>(quantized_raw_binary.data() + quantized_block[i].offset_);
+    if (block[i].type_ == magic_enum::enum_integer(RawBinaryBlockEnum::Element) && block[i].number_ > 0) {
+      const Isize element_value_number = value_number / block[i].number_;
+      const Isize mode_number = element_value_number / element_row_sum;
+      parallelFor(0, block[i].number_, [&](const tbb::blocked_range<Isize>& range) {
+        for (Isize j = range.begin(); j != range.end(); j++) {
+          Isize matrix_offset = j * element_value_number;
+          for (const Isize row_number : element_row_number) {
+            const Eigen::Map<const Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic>> element_value(
+                value + matrix_offset, row_number, mode_number);
+            Eigen::Map<Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic>> element_quantized_value(
+                quantized_value + matrix_offset, row_number, mode_number);
+            for (Isize k = 0; k < row_number; k++) {
+              const Real row_tolerance = tolerance * element_value.row(k).cwiseAbs().maxCoeff();
+              for (Isize l = 0; l < mode_number; l++) {
+                element_quantized_value(k, l) = l == 0 || std::abs(element_value(k, l)) >= row_tolerance
+                                                    ? static_cast<float>(element_value(k, l))
+                                                    : 0.0F;
+              }
+            }
+            matrix_offset += row_number * mode_number;
+          }
+        }
+      });
+    } else {
+      parallelFor(0, value_number, [&](const tbb::blocked_range<Isize>& range) {
+        for (Isize j = range.begin(); j != range.end(); j++) {
+          quantized_value[j] = static_cast<float>(value[j]);
+        }
+      });
+    }
+  }
+}
+
+inline void dequantizeRawBinary(const std::vector<RawBinaryBlock>& quantized_block,
+                                const std::vector<char>& quantized_raw_binary, const std::vector<RawBinaryBlock>& block,
+                                std::vector<char>& raw_binary) {
+  raw_binary.resize(block.back().offset_ + block.back().size_);
+  for (std::size_t i = 0; i < block.size(); i++) {
+    const float* quantized_value = reinterpret_cast<const float*>(quantized_raw_binary.data() +
+                                                                  quantized_block[i].offset_);
+    Real* value = reinterpret_cast<Real*>(raw_binary.data() + block[i].offset_);
+    parallelFor(0, static_cast<Isize>(block[i].size_ / sizeof(Real)), [&](const tbb::blocked_range<Isize>& range) {
+      for (Isize j = range.begin(); j != range.end(); j++) {
+        value[j] = static_cast<Real>(quantized_value[j]);
+      }
+    });
+  }
+}
+
+// NOTE: XOR is its own inverse and bit exact, the bytes of a value that did not change between two snapshots become
+// zeros that zstd compresses almost for free. The reference is replaced by the current snapshot on the way.
+inline void encodeRawBinaryDelta(std::vector<char>& reference_raw_binary, std::vector<char>& raw_binary) {
+  const std::size_t word_number = raw_binary.size() / sizeof(std::uint64_t);
+  parallelFor(0, static_cast<Isize>(word_number), [&](const tbb::blocked_range<Isize>& range) {
+    for (Isize i = range.begin(); i != range.end(); i++) {
+      const std::size_t offset = static_cast<std::size_t>(i) * sizeof(std::uint64_t);
+      std::uint64_t word;
+      std::uint64_t reference_word;
+      std::memcpy(&word, raw_binary.data() + offset, sizeof(std::uint64_t));
+      std::memcpy(&reference_word, reference_raw_binary.data() + offset, sizeof(std::uint64_t));
+      reference_word ^= word;
+      std::memcpy(raw_binary.data() + offset, &reference_word, sizeof(std::uint64_t));
+      std::memcpy(reference_raw_binary.data() + offset, &word, sizeof(std::uint64_t));
+    }
+  });
+  for (std::size_t i = word_number * sizeof(std::uint64_t); i < raw_binary.size(); i++) {
+    std::swap(raw_binary[i], reference_raw_binary[i]);
+    raw_binary[i] ^= reference_raw_binary[i];
+  }
+}
+
+inline void decodeRawBinaryDelta(const char* delta_raw_binary, const std::size_t size, char* raw_binary) {
+  const std::size_t word_number = size / sizeof(std::uint64_t);
+  parallelFor(0, static_cast<Isize>(word_number), [&](const tbb::blocked_range<Isize>& range) {
+    for (Isize i = range.begin(); i != range.end(); i++) {
+      const std::size_t offset = static_cast<std::size_t>(i) * sizeof(std::uint64_t);
+      std::uint64_t word;
+      std::uint64_t delta_word;
+      std::memcpy(&word, raw_binary + offset, sizeof(std::uint64_t));
+      std::memcpy(&delta_word, delta_raw_binary + offset, sizeof(std::uint64_t));
+      word ^= delta_word;
+      std::memcpy(raw_binary + offset, &word, sizeof(std::uint64_t));
+    }
+  });
+  for (std::size_t i = word_number * sizeof(std::uint64_t); i < size; i++) {
+    raw_binary[i] ^= delta_raw_binary[i];
+  }
+}
+
+// NOTE: Snapshots are named prefix_iteration, the reference of a delta snapshot lives next to it.
+inline std::filesystem::path getRawBinaryReferencePath(const std::filesystem::path& raw_binary_path,
+                                                       const int reference_iteration) {
+  const std::string raw_binary_stem = raw_binary_path.stem().string();
+  return raw_binary_path.parent_path() / std::format("{}_{}{}", raw_binary_stem.substr(0, raw_binary_stem.rfind('_')),
+                                                     reference_iteration, raw_binary_path.extension().string());
+}
+
+struct RawBinaryFile {
+  const char* data_{nullptr};
+  std::size_t size_{0};
+
+  inline explicit RawBinaryFile(const std::filesystem::path& raw_binary_path) {
+    const int raw_binary_file_descriptor = open(raw_binary_path.c_str(), O_RDONLY);
+    if (raw_binary_file_descriptor == -1) [[unlikely]] {
+      throw std::runtime_error(std::format("Cannot open raw binary file {}.", raw_binary_path.string()));
+    }
+    this->size_ = static_cast<std::size_t>(std::filesystem::file_size(raw_binary_path));
+    void* raw_binary_file = mmap(nullptr, this->size_, PROT_READ, MAP_PRIVATE, raw_binary_file_descriptor, 0);
+    close(raw_binary_file_descriptor);
+    if (raw_binary_file == MAP_FAILED) [[unlikely]] {
+      throw std::runtime_error(std::format("Cannot map raw binary file {}.", raw_binary_path.string()));
+    }
+    this->data_ = static_cast<const char*>(raw_binary_file);
+  }
+
+  RawBinaryFile(const RawBinaryFile&) = delete;
+
+  RawBinaryFile& operator=(const RawBinaryFile&) = delete;
+
+  inline ~RawBinaryFile() { munmap(const_cast<char*>(this->data_), this->size_); }
+};
+
+struct RawBinaryCompress {
+  // NOTE: Each block is split into chunks, each chunk is byte shuffled and compressed into an independent zstd frame.
+  inline static void write(const std::filesystem::path& raw_binary_path, RawBinaryHeader& header,
+                           std::vector<RawBinaryBlock>& block, const std::vector<char>& raw_binary,
+                           const int compression_level, std::vector<std::vector<char>>& compressed,
+                           std::vector<std::size_t>& compressed_size) {
+    std::vector<std::size_t> chunk_offset;
+    std::vector<std::size_t> chunk_size;
+    std::vector<std::size_t> chunk_shuffle_size;
+    std::vector<std::size_t> block_chunk_offset{0};
+    for (const RawBinaryBlock& raw_binary_block : block) {
+      for (std::size_t i = 0; i < raw_binary_block.size_; i += kRawBinaryChunkSize) {
+        chunk_offset.emplace_back(raw_binary_block.offset_ + i);
+        chunk_size.emplace_back(std::ranges::min(kRawBinaryChunkSize, raw_binary_block.size_ - i));
+        chunk_shuffle_size.emplace_back(static_cast<std::size_t>(raw_binary_block.shuffle_size_));
+      }
+      block_chunk_offset.emplace_back(chunk_offset.size());
+    }
+    std::vector<std::uint64_t> chunk_checksum(chunk_offset.size());
+    compressed.resize(chunk_offset.size());
+    compressed_size.resize(chunk_offset.size());
+    tbb::enumerable_thread_specific<std::vector<char>> thread_shuffled_raw_binary;
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, chunk_offset.size()),
+                      [&](const tbb::blocked_range<std::size_t>& range) {
+                        std::vector<char>& shuffled_raw_binary = thread_shuffled_raw_binary.local();
+                        for (std::size_t i = range.begin(); i != range.end(); i++) {
+                          const char* chunk = raw_binary.data() + chunk_offset[i];
+                          if (chunk_shuffle_size[i] > 1) {
+                            shuffled_raw_binary.resize(chunk_size[i]);
+                            shuffleRawBinary(chunk, chunk_size[i], chunk_shuffle_size[i], shuffled_raw_binary.data());
+                            chunk = shuffled_raw_binary.data();
+                          }
+                          compressed[i].resize(ZSTD_compressBound(chunk_size[i]));
+                          compressed_size[i] = ZSTD_compress(compressed[i].data(), compressed[i].size(), chunk,
+                                                             chunk_size[i], compression_level);
+                          if (ZSTD_isError(compressed_size[i])) [[unlikely]] {
+                            throw std::runtime_error(std::format("Raw binary file {} can not compress chunk {}: {}.",
+                                                                 raw_binary_path.string(), i,
+                                                                 ZSTD_getErrorName(compressed_size[i])));
+                          }
+                          chunk_checksum[i] = getRawBinaryChecksum(raw_binary.data() + chunk_offset[i], chunk_size[i]);
+                        }
+                      });
+    header.block_number_ = static_cast<std::uint32_t>(block.size());
+    std::size_t compressed_offset = sizeof(RawBinaryHeader) + block.size() * sizeof(RawBinaryBlock);
+    for (std::size_t i = 0; i < block.size(); i++) {
+      block[i].compressed_offset_ = compressed_offset;
+      for (std::size_t j = block_chunk_offset[i]; j < block_chunk_offset[i + 1]; j++) {
+        compressed_offset += compressed_size[j];
+      }
+      block[i].compressed_size_ = compressed_offset - block[i].compressed_offset_;
+      block[i].checksum_ = getRawBinaryChecksum(
+          reinterpret_cast<const char*>(chunk_checksum.data() + block_chunk_offset[i]),
+          (block_chunk_offset[i + 1] - block_chunk_offset[i]) * sizeof(std::uint64_t));
+    }
+    // NOTE: The file is written under a temporary name and renamed into place, so a view that follows the solve never
+    // reads a partial snapshot.
+    std::filesystem::path partial_raw_binary_path = raw_binary_path;
+    partial_raw_binary_path += ".part";
+    std::fstream raw_binary_fout(partial_raw_binary_path, std::ios::out | std::ios::binary | std::ios::trunc);
+    raw_binary_fout.write(reinterpret_cast<const char*>(&header),
+                          static_cast<std::streamsize>(sizeof(RawBinaryHeader)));
+    raw_binary_fout.write(reinterpret_cast<const char*>(block.data()),
+                          static_cast<std::streamsize>(block.size() * sizeof(RawBinaryBlock)));
+    for (std::size_t i = 0; i < chunk_offset.size(); i++) {
+      raw_binary_fout.write(compressed[i].data(), static_cast<std::streamsize>(compressed_size[i]));
+    }
+    raw_binary_fout.close();
+    if (!raw_binary_fout) [[unlikely]] {
+      std::filesystem::remove(partial_raw_binary_path);
+      throw std::runtime_error(std::format("Raw binary file {} can not be written.", raw_binary_path.string()));
+    }
+    std::filesystem::rename(partial_raw_binary_path, raw_binary_path);
+  }
+
+  inline static void readHeader(const std::filesystem::path& raw_binary_path, const RawBinaryFile& raw_binary_file,
+                                RawBinaryHeader& header, std::vector<RawBinaryBlock>& block) {
+    if (raw_binary_file.size_ < sizeof(RawBinaryHeader)) [[unlikely]] {
+      throw std::runtime_error(std::format("Raw binary file {} is truncated.", raw_binary_path.string()));
+    }
+    std::memcpy(&header, raw_binary_file.data_, sizeof(RawBinaryHeader));
+    if (header.magic_ != kRawBinaryMagic || header.version_ != kRawBinaryVersion) [[unlikely]] {
+      throw std::runtime_error(
+          std::format("Raw binary file {} is not a version {} snapshot.", raw_binary_path.string(), kRawBinaryVersion));
+    }
+    if (raw_binary_file.size_ < sizeof(RawBinaryHeader) + header.block_number_ * sizeof(RawBinaryBlock)) [[unlikely]] {
+      throw std::runtime_error(std::format("Raw binary file {} is truncated.", raw_binary_path.string()));
+    }
+    block.resize(header.block_number_);
+    std::memcpy(block.data(), raw_binary_file.data_ + sizeof(RawBinaryHeader),
+                header.block_number_ * sizeof(RawBinaryBlock));
+  }
+
+  inline static void readHeader(const std::filesystem::path& raw_binary_path, RawBinaryHeader& header,
+                                std::vector<RawBinaryBlock>& block) {
+    const RawBinaryFile raw_binary_file(raw_binary_path);
+    readHeader(raw_binary_path, raw_binary_file, header, block);
+  }
+
+  // NOTE: Only the blocks accepted by is_block_needed are decompressed, the rest of the buffer is left untouched. The
+  // frames are decompressed in parallel straight from the mapped file and every block is checked against its checksum.
+  inline static void readFile(const std::filesystem::path& raw_binary_path, RawBinaryHeader& header,
+                          std::vector<RawBinaryBlock>& block, std::vector<char>& raw_binary,
+                          const std::function<bool(const RawBinaryBlock&)>& is_block_needed = nullptr) {
+    const RawBinaryFile raw_binary_file(raw_binary_path);
+    readHeader(raw_binary_path, raw_binary_file, header, block);
+    std::size_t raw_binary_size = 0;
+    std::vector<std::size_t> block_index;
+    std::vector<std::size_t> frame_offset;
+    std::vector<std::size_t> frame_size;
+    std::vector<std::size_t> frame_original_offset;
+    std::vector<std::size_t> frame_original_size;
+    std::vector<std::size_t> frame_shuffle_size;
+    std::vector<std::size_t> block_frame_offset{0};
+    for (std::size_t i = 0; i < block.size(); i++) {
+      raw_binary_size = std::ranges::max(raw_binary_size, static_cast<std::size_t>(block[i].offset_ + block[i].size_));
+      if (is_block_needed && !is_block_needed(block[i])) {
+        continue;
+      }
+      if (block[i].compressed_offset_ + block[i].compressed_size_ > raw_binary_file.size_) [[unlikely]] {
+        throw std::runtime_error(std::format("Raw binary file {} is truncated.", raw_binary_path.string()));
+      }
+      std::size_t compressed_offset = block[i].compressed_offset_;
+      std::size_t original_offset = block[i].offset_;
+      while (compressed_offset < block[i].compressed_offset_ + block[i].compressed_size_) {
+        const char* frame = raw_binary_file.data_ + compressed_offset;
+        const std::size_t frame_capacity = block[i].compressed_offset_ + block[i].compressed_size_ - compressed_offset;
+        const std::size_t compressed_frame_size = ZSTD_findFrameCompressedSize(frame, frame_capacity);
+        const unsigned long long frame_content_size = ZSTD_getFrameContentSize(frame, frame_capacity);
+        if (ZSTD_isError(compressed_frame_size) || frame_content_size == ZSTD_CONTENTSIZE_UNKNOWN ||
+            frame_content_size == ZSTD_CONTENTSIZE_ERROR) [[unlikely]] {
+          throw std::runtime_error(
+              std::format("Raw binary file {} is broken at block {}.", raw_binary_path.string(), i));
+        }
+        frame_offset.emplace_back(compressed_offset);
+        frame_size.emplace_back(compressed_frame_size);
+        frame_original_offset.emplace_back(original_offset);
+        frame_original_size.emplace_back(static_cast<std::size_t>(frame_content_size));
+        frame_shuffle_size.emplace_back(static_cast<std::size_t>(block[i].shuffle_size_));
+        compressed_offset += compressed_frame_size;
+        original_offset += static_cast<std::size_t>(frame_content_size);
+      }
+      if (original_offset != block[i].offset_ + block[i].size_) [[unlikely]] {
+        throw std::runtime_error(std::format("Raw binary file {} is broken at block {}.", raw_binary_path.string(), i));
+      }
+      block_index.emplace_back(i);
+      block_frame_offset.emplace_back(frame_offset.size());
+    }
+    raw_binary.resize(raw_binary_size);
+    std::vector<std::uint64_t> frame_checksum(frame_offset.size());
+    tbb::enumerable_thread_specific<std::vector<char>> thread_shuffled_raw_binary;
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, frame_offset.size()),
+                      [&](const tbb::blocked_range<std::size_t>& range) {
+                        std::vector<char>& shuffled_raw_binary = thread_shuffled_raw_binary.local();
+                        for (std::size_t i = range.begin(); i != range.end(); i++) {
+                          char* frame_raw_binary = raw_binary.data() + frame_original_offset[i];
+                          if (frame_shuffle_size[i] > 1) {
+                            shuffled_raw_binary.resize(frame_original_size[i]);
+                            frame_raw_binary = shuffled_raw_binary.data();
+                          }
+                          const std::size_t decompressed_size =
+                              ZSTD_decompress(frame_raw_binary, frame_original_size[i],
+                                              raw_binary_file.data_ + frame_offset[i], frame_size[i]);
+                          if (decompressed_size != frame_original_size[i]) [[unlikely]] {
+                            throw std::runtime_error(std::format(
+                                "Raw binary file {} can not decompress frame {}: {}.", raw_binary_path.string(), i,
+                                ZSTD_isError(decompressed_size)
+                                    ? ZSTD_getErrorName(decompressed_size)
+                                    : std::format("{} of {} bytes", decompressed_size, frame_original_size[i])));
+                          }
+                          if (frame_shuffle_size[i] > 1) {
+                            unshuffleRawBinary(shuffled_raw_binary.data(), decompressed_size, frame_shuffle_size[i],
+                                               raw_binary.data() + frame_original_offset[i]);
+                          }
+                          frame_checksum[i] =
+                              getRawBinaryChecksum(raw_binary.data() + frame_original_offset[i], decompressed_size);
+                        }
+                      });
+    for (std::size_t i = 0; i < block_index.size(); i++) {
+      if (getRawBinaryChecksum(reinterpret_cast<const char*>(frame_checksum.data() + block_frame_offset[i]),
+                               (block_frame_offset[i + 1] - block_frame_offset[i]) * sizeof(std::uint64_t)) !=
+          block[block_index[i]].checksum_) [[unlikely]] {
+        throw std::runtime_error(std::format("Raw binary file {} fails the checksum at block {}.",
+                                             raw_binary_path.string(), block_index[i]));
+      }
+    }
+  }
+  // NOTE: Since XOR commutes, the deltas back to the keyframe can be folded into the snapshot in any order, so the
+  // chain is walked backwards from the requested file and only one extra buffer is needed.
+  inline static void read(const std::filesystem::path& raw_binary_path, RawBinaryHeader& header,
+                          std::vector<RawBinaryBlock>& block, std::vector<char>& raw_binary,
+                          const std::function<bool(const RawBinaryBlock&)>& is_block_needed = nullptr) {
+    readFile(raw_binary_path, header, block, raw_binary, is_block_needed);
+    std::filesystem::path reference_raw_binary_path = raw_binary_path;
+    RawBinaryHeader reference_header = header;
+    std::vector<RawBinaryBlock> reference_block;
+    std::vector<char> reference_raw_binary;
+    while (reference_header.reference_iteration_ >= 0) {
+      reference_raw_binary_path =
+          getRawBinaryReferencePath(reference_raw_binary_path, reference_header.reference_iteration_);
+      readFile(reference_raw_binary_path, reference_header, reference_block, reference_raw_binary, is_block_needed);
+      if (reference_header.type_ != header.type_ || reference_block.size() != block.size()) [[unlikely]] {
+        throw std::runtime_error(std::format("Raw binary file {} does not match its delta snapshot {}.",
+                                             reference_raw_binary_path.string(), raw_binary_path.string()));
+      }
+      for (std::size_t i = 0; i < block.size(); i++) {
+        if (reference_block[i].offset_ != block[i].offset_ || reference_block[i].size_ != block[i].size_)
+            [[unlikely]] {
+          throw std::runtime_error(std::format("Raw binary file {} does not match its delta snapshot {}.",
+                                               reference_raw_binary_path.string(), raw_binary_path.string()));
+        }
+        if (is_block_needed && !is_block_needed(block[i])) {
+          continue;
+        }
+        decodeRawBinaryDelta(reference_raw_binary.data() + block[i].offset_, block[i].size_,
+                             raw_binary.data() + block[i].offset_);
+      }
+    }
+  }
+};
+
+// NOTE: The solver hands its packed buffer over and gets a recycled one back, push only blocks when capacity snapshots
+// are still waiting to be compressed.
+struct RawBinaryWriteQueue {
+  struct RawBinaryWriteTask {
+    std::filesystem::path raw_binary_path_;
+    RawBinaryHeader header_;
+    std::vector<RawBinaryBlock> block_;
+    std::vector<char> raw_binary_;
+  };
+
+  int compression_level_{1};
+  Usize capacity_{2};
+
+  std::deque<RawBinaryWriteTask> queue_;
+  std::vector<std::vector<char>> free_raw_binary_;
+  std::vector<std::vector<char>> compressed_;
+  std::vector<std::size_t> compressed_size_;
+  bool is_writing_{false};
+  bool is_finished_{false};
+  std::exception_ptr exception_;
+  std::mutex mutex_;
+  std::condition_variable condition_variable_;
+  std::thread thread_;
+
+  inline void push(const std::filesystem::path& raw_binary_path, const RawBinaryHeader& header,
+                   const std::vector<RawBinaryBlock>& block, std::vector<char>& raw_binary) {
+    std::unique_lock<std::mutex> lock(this->mutex_);
+    if (!this->thread_.joinable()) {
+      this->thread_ = std::thread([this] { this->writeRawBinary(); });
+    }
+    this->condition_variable_.wait(lock, [this] { return this->queue_.size() < this->capacity_; });
+    this->rethrowException();
+    this->queue_.emplace_back(raw_binary_path, header, block, std::move(raw_binary));
+    if (this->free_raw_binary_.empty()) {
+      raw_binary = std::vector<char>();
+    } else {
+      raw_binary = std::move(this->free_raw_binary_.back());
+      this->free_raw_binary_.pop_back();
+    }
+    this->condition_variable_.notify_all();
+  }
+
+  inline void wait() {
+    std::unique_lock<std::mutex> lock(this->mutex_);
+    this->condition_variable_.wait(lock, [this] { return this->queue_.empty() && !this->is_writing_; });
+    this->rethrowException();
+  }
+
+  // NOTE: An error of the writer thread is kept and thrown on the solver thread by the next push or wait, the first
+  // error wins and the writer goes on with the snapshots after it.
+  inline void rethrowException() {
+    if (this->exception_) [[unlikely]] {
+      std::rethrow_exception(std::exchange(this->exception_, nullptr));
+    }
+  }
+
+  inline void writeRawBinary() {
+    std::unique_lock<std::mutex> lock(this->mutex_);
+    while (true) {
+      this->condition_variable_.wait(lock, [this] { return !this->queue_.empty() || this->is_finished_; });
+      if (this->queue_.empty()) {
+        return;
+      }
+      RawBinaryWriteTask raw_binary_write_task = std::move(this->queue_.front());
+      this->queue_.pop_front();
+      this->is_writing_ = true;
+      this->condition_variable_.notify_all();
+      lock.unlock();
+      std::exception_ptr exception;
+      try {
+        RawBinaryCompress::write(raw_binary_write_task.raw_binary_path_, raw_binary_write_task.header_,
+                                 raw_binary_write_task.block_, raw_binary_write_task.raw_binary_,
+                                 this->compression_level_, this->compressed_, this->compressed_size_);
+      } catch (...) {
+        exception = std::current_exception();
+      }
+      lock.lock();
+      if (exception && !this->exception_) {
+        this->exception_ = exception;
+      }
+      this->free_raw_binary_.emplace_back(std::move(raw_binary_write_task.raw_binary_));
+      this->is_writing_ = false;
+      this->condition_variable_.notify_all();
+    }
+  }
+
+  inline RawBinaryWriteQueue() = default;
+
+  inline ~RawBinaryWriteQueue() {
+    {
+      std::unique_lock<std::mutex> lock(this->mutex_);
+      this->is_finished_ = true;
+    }
+    this->condition_variable_.notify_all();
+    if (this->thread_.joinable()) {
+      this->thread_.join();
+    }
+  }
+};
+
+}  // namespace SubrosaDG
+
+#endif  // SUBROSA_DG_RAW_BINARY_COMPRESS_CPP_
@@ -0,0 +1,556 @@
+/**
+ * @file Statistics.cpp
+ * @brief The header file of SubrosaDG running statistics.
+ *
+ * @author Yufei.Liu, Calm.Liu@outlook.com | Chenyu.Bao, bcynuaa@163.com
+ * @date 2025-04-16
+ *
+ * @version 0.1.0
+ * @copyright Copyright (c) 2022 - 2025 by SubrosaDG developers. All rights reserved.
+ * SubrosaDG is free software and is distributed under the MIT license.
+ */
+
+#ifndef SUBROSA_DG_STATISTICS_CPP_
+#define SUBROSA_DG_STATISTICS_CPP_
+
+#include <oneapi/tbb.h>
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <ios>
+#include <iostream>
+#include <magic_enum/magic_enum.hpp>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <vtu11-cpp17.hpp>
+
+#include "Mesh/ReadControl.cpp"
+#include "Solver/PhysicalModel.cpp"
+#include "Solver/SimulationControl.cpp"
+#include "Solver/SolveControl.cpp"
+#include "Solver/VariableConvertor.cpp"
+#include "Utils/BasicDataType.cpp"
+#include "Utils/Constant.cpp"
+#include "Utils/Enum.cpp"
+#include "Utils/ParallelControl.cpp"
+#include "View/IOControl.cpp"
+#include "View/Paraview.cpp"
+#include "View/VtuWriter.cpp"
+
+namespace SubrosaDG {
+
+inline constexpr std::array<char, 8> kStatisticsMagic{'S', 'D', 'G', 'S', 'T', 'A', 'T', 'S'};
+inline constexpr std::uint32_t kStatisticsVersion{1};
+
+// NOTE: The statistics variables are the primitive variables followed by the pressure, with the velocity split into its
+// components.
+template <typename SimulationControl>
+inline Isize getStatisticsVariableIndex(const ViewVariableEnum variable_type) {
+  switch (variable_type) {
+  case ViewVariableEnum::Density:
+    return 0;
+  case ViewVariableEnum::VelocityX:
+    return 1;
+  case ViewVariableEnum::VelocityY:
+    if constexpr (SimulationControl::kDimension >= 2) {
+      return 2;
+    }
+    break;
+  case ViewVariableEnum::VelocityZ:
+    if constexpr (SimulationControl::kDimension == 3) {
+      return 3;
+    }
+    break;
+  case ViewVariableEnum::Temperature:
+    return SimulationControl::kDimension + 1;
+  case ViewVariableEnum::Pressure:
+    return SimulationControl::kDimension + 2;
+  default:
+    break;
+  }
+  throw std::runtime_error(
+      std::format("View variable {} has no running statistics.", magic_enum::enum_name(variable_type)));
+}
+
+template <typename SimulationControl>
+struct StatisticsPhysical {
+  Isize physical_index_;
+  std::string name_;
+  std::vector<int> element_gmsh_type_;
+  std::vector<Isize> element_index_;
+  std::vector<ViewIndex<SimulationControl>> view_index_;
+  ViewSupplemental<SimulationControl> view_supplemental_;
+};
+
+// NOTE: Each element holds the running means of the statistics variables, of their squares and of the products of the
+// correlation pairs as modal coefficients, one row per quantity. A sample is evaluated at the quadrature nodes and
+// projected in the least squares sense, the same way as an initial condition given by a function, and the means are
+// updated with mean += (sample - mean) / n. The accumulator file starts with the magic, the version, the dimension, the
+// polynomial order, the real size, the variable number, the pair number, the variable index of each pair, the start
+// step, the interval, the last accumulated step, the sample number and the column number, followed by the coefficients
+// of all elements in the order of the raw binary. The variance and the covariance are only formed at the view nodes.
+template <typename SimulationControl>
+struct Statistics {
+  inline static constexpr int kVariableNumber{SimulationControl::kPrimitiveVariableNumber + 1};
+
+  bool is_open_{false};
+  int start_step_{0};
+  int interval_{0};
+  int sample_number_{0};
+  int last_step_{-1};
+  int write_step_{-1};
+  std::vector<std::pair<ViewVariableEnum, ViewVariableEnum>> correlation_;
+  std::vector<std::pair<Isize, Isize>> correlation_index_;
+  Isize row_number_{0};
+  std::filesystem::path output_directory_;
+  std::string output_file_name_prefix_;
+  Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic> accumulator_;
+  std::vector<StatisticsPhysical<SimulationControl>> physical_;
+  std::vector<vtu11::DataSetInfo> data_set_information_;
+
+  [[nodiscard]] inline std::filesystem::path getAccumulatorFilePath() const {
+    return this->output_directory_ / std::format("{}_statistics.bin", this->output_file_name_prefix_);
+  }
+
+  template <typename ElementTrait>
+  [[nodiscard]] inline static Isize getElementColumnOffset(const Mesh<SimulationControl>& mesh) {
+    Isize column_offset = 0;
+    if constexpr (SimulationControl::kDimension == 2) {
+      if constexpr (ElementTrait::kElementType == ElementEnum::Quadrangle) {
+        column_offset +=
+            mesh.triangle_.number_ * TriangleTrait<SimulationControl::kPolynomialOrder>::kBasisFunctionNumber;
+      }
+    } else if constexpr (SimulationControl::kDimension == 3) {
+      if constexpr (ElementTrait::kElementType == ElementEnum::Pyramid ||
+                    ElementTrait::kElementType == ElementEnum::Hexahedron) {
+        column_offset +=
+            mesh.tetrahedron_.number_ * TetrahedronTrait<SimulationControl::kPolynomialOrder>::kBasisFunctionNumber;
+      }
+      if constexpr (ElementTrait::kElementType == ElementEnum::Hexahedron) {
+        column_offset +=
+            mesh.pyramid_.number_ * PyramidTrait<SimulationControl::kPolynomialOrder>::kBasisFunctionNumber;
+      }
+    }
+    return column_offset;
+  }
+
+  [[nodiscard]] inline static Isize getColumnNumber(const Mesh<SimulationControl>& mesh) {
+    if constexpr (SimulationControl::kDimension == 1) {
+      return mesh.line_.number_ * LineTrait<SimulationControl::kPolynomialOrder>::kBasisFunctionNumber;
+    } else if constexpr (SimulationControl::kDimension == 2) {
+      return getElementColumnOffset<QuadrangleTrait<SimulationControl::kPolynomialOrder>>(mesh) +
+             mesh.quadrangle_.number_ * QuadrangleTrait<SimulationControl::kPolynomialOrder>::kBasisFunctionNumber;
+    } else if constexpr (SimulationControl::kDimension == 3) {
+      return getElementColumnOffset<HexahedronTrait<SimulationControl::kPolynomialOrder>>(mesh) +
+             mesh.hexahedron_.number_ * HexahedronTrait<SimulationControl::kPolynomialOrder>::kBasisFunctionNumber;
+    }
+  }
+
+  [[nodiscard]] inline static std::string_view getVariableName(const Isize variable_index) {
+    if (variable_index == 0) {
+      return magic_enum::enum_name(ViewVariableEnum::Density);
+    }
+    if (variable_index <= SimulationControl::kDimension) {
+      constexpr std::array<ViewVariableEnum, 3> kVelocity{ViewVariableEnum::VelocityX, ViewVariableEnum::VelocityY,
+                                                          ViewVariableEnum::VelocityZ};
+      return magic_enum::enum_name(kVelocity[static_cast<Usize>(variable_index) - 1]);
+    }
+    if (variable_index == SimulationControl::kDimension + 1) {
+      return magic_enum::enum_name(ViewVariableEnum::Temperature);
+    }
+    return magic_enum::enum_name(ViewVariableEnum::Pressure);
+  }
+
+  [[nodiscard]] inline std::vector<std::uint32_t> getHeader() const {
+    std::vector<std::uint32_t> header{kStatisticsVersion,
+                                      static_cast<std::uint32_t>(SimulationControl::kDimension),
+                                      static_cast<std::uint32_t>(SimulationControl::kPolynomialOrder),
+                                      static_cast<std::uint32_t>(kRealSize),
+                                      static_cast<std::uint32_t>(kVariableNumber),
+                                      static_cast<std::uint32_t>(this->correlation_index_.size())};
+    for (const auto& [first_index, second_index] : this->correlation_index_) {
+      header.emplace_back(static_cast<std::uint32_t>(first_index));
+      header.emplace_back(static_cast<std::uint32_t>(second_index));
+    }
+    header.emplace_back(static_cast<std::uint32_t>(this->start_step_));
+    header.emplace_back(static_cast<std::uint32_t>(this->interval_));
+    return header;
+  }
+
+  // NOTE: The accumulators are resumed when the file was written with the same settings and no sample was taken
+  // between its last step and the step the solver restarts from, otherwise the accumulation starts again from zero.
+  inline void readAccumulator(const int iteration_start) {
+    const std::filesystem::path accumulator_file_path = this->getAccumulatorFilePath();
+    std::ifstream fin(accumulator_file_path, std::ios::in | std::ios::binary);
+    if (!fin.is_open()) {
+      return;
+    }
+    const auto discard = [&accumulator_file_path](const std::string_view reason) {
+      std::cout << std::format("Statistics accumulator {} is discarded: {}.", accumulator_file_path.string(), reason)
+                << '\n';
+    };
+    std::array<char, 8> magic;
+    std::vector<std::uint32_t> header(this->getHeader().size());
+    std::array<std::int32_t, 2> step;
+    std::uint64_t column_number;
+    fin.read(magic.data(), static_cast<std::streamsize>(magic.size()));
+    fin.read(reinterpret_cast<char*>(header.data()),
+             static_cast<std::streamsize>(header.size() * sizeof(std::uint32_t)));
+    fin.read(reinterpret_cast<char*>(step.data()), static_cast<std::streamsize>(step.size() * sizeof(std::int32_t)));
+    fin.read(reinterpret_cast<char*>(&column_number), sizeof(std::uint64_t));
+    if (!fin || magic != kStatisticsMagic || header != this->getHeader() ||
+        column_number != static_cast<std::uint64_t>(this->accumulator_.cols())) {
+      discard("the settings or the mesh differ");
+      return;
+    }
+    const int next_sample_step =
+        step[0] < this->start_step_
+            ? this->start_step_
+            : this->start_step_ + ((step[0] - this->start_step_) / this->interval_ + 1) * this->interval_;
+    if (step[0] > iteration_start) {
+      discard(std::format("its last step {} is after the restart step {}", step[0], iteration_start));
+      return;
+    }
+    if (next_sample_step <= iteration_start) {
+      discard(std::format("the sample of step {} before the restart step {} is missing", next_sample_step,
+                          iteration_start));
+      return;
+    }
+    fin.read(reinterpret_cast<char*>(this->accumulator_.data()),
+             static_cast<std::streamsize>(this->accumulator_.size()) * kRealSize);
+    if (!fin) {
+      this->accumulator_.setZero();
+      discard("its data is truncated");
+      return;
+    }
+    this->last_step_ = step[0];
+    this->write_step_ = step[0];
+    this->sample_number_ = step[1];
+  }
+
+  template <typename ElementTrait>
+  inline void addPhysicalElement(const Mesh<SimulationControl>& mesh,
+                                 StatisticsPhysical<SimulationControl>& statistics_physical, const Isize element_index,
+                                 ViewIndex<SimulationControl>& view_index) {
+    const ElementMesh<ElementTrait>& element_mesh =
+        mesh.*(Mesh<SimulationControl>::template getElement<ElementTrait>());
+    statistics_physical.view_index_.emplace_back(view_index);
+    for (Isize i = 0; i < ElementTrait::kAllNodeNumber; i++) {
+      statistics_physical.view_supplemental_.node_coordinate_(
+          Eigen::seqN(Eigen::fix<0>, Eigen::fix<SimulationControl::kDimension>), view_index.node_index_ + i) =
+          element_mesh.element_(element_index).node_coordinate_(Eigen::all, i);
+    }
+    writeElementConnectivity<ElementTrait>(view_index, statistics_physical.view_supplemental_);
+    view_index.node_index_ += ElementTrait::kAllNodeNumber;
+    view_index.vtk_node_index_ += ElementTrait::kVtkAllNodeNumber;
+    view_index.vtk_element_index_ += ElementTrait::kVtkElementNumber;
+  }
+
+  // NOTE: The geometry of every physical group of the computational domain is written once here, later snapshots only
+  // fill the point data.
+  inline void initializePhysical(const Mesh<SimulationControl>& mesh) {
+    this->physical_.clear();
+    for (Isize i = 0; i < mesh.information_.physical_number_; i++) {
+      const PhysicalInformation& physical = mesh.information_.physical_[static_cast<Usize>(i)];
+      if (physical.dimension_ != SimulationControl::kDimension) {
+        continue;
+      }
+      StatisticsPhysical<SimulationControl>& statistics_physical = this->physical_.emplace_back();
+      statistics_physical.physical_index_ = i;
+      statistics_physical.name_ = physical.name_;
+      statistics_physical.element_gmsh_type_ = physical.element_gmsh_type_;
+      statistics_physical.view_supplemental_.resize(0, physical.element_number_, physical.node_number_,
+                                                    physical.vtk_node_number_, physical.vtk_element_number_, {});
+      ViewIndex<SimulationControl> view_index;
+      for (Isize j = 0; j < physical.element_number_; j++) {
+        const Isize element_index = mesh.information_.gmsh_tag_to_element_physical_information_
+                                        .at(physical.element_gmsh_tag_[static_cast<Usize>(j)])
+                                        .element_index_;
+        statistics_physical.element_index_.emplace_back(element_index);
+        const int element_gmsh_type = physical.element_gmsh_type_[static_cast<Usize>(j)];
+        if constexpr (SimulationControl::kDimension == 1) {
+          this->addPhysicalElement<LineTrait<SimulationControl::kPolynomialOrder>>(mesh, statistics_physical,
+                                                                                    element_index, view_index);
+        } else if constexpr (SimulationControl::kDimension == 2) {
+          if (element_gmsh_type == TriangleTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+            this->addPhysicalElement<TriangleTrait<SimulationControl::kPolynomialOrder>>(mesh, statistics_physical,
+                                                                                          element_index, view_index);
+          } else if (element_gmsh_type == QuadrangleTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+            this->addPhysicalElement<QuadrangleTrait<SimulationControl::kPolynomialOrder>>(mesh, statistics_physical,
+                                                                                            element_index, view_index);
+          }
+        } else if constexpr (SimulationControl::kDimension == 3) {
+          if (element_gmsh_type == TetrahedronTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+            this->addPhysicalElement<TetrahedronTrait<SimulationControl::kPolynomialOrder>>(mesh, statistics_physical,
+                                                                                             element_index, view_index);
+          } else if (element_gmsh_type == PyramidTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+            this->addPhysicalElement<PyramidTrait<SimulationControl::kPolynomialOrder>>(mesh, statistics_physical,
+                                                                                         element_index, view_index);
+          } else if (element_gmsh_type == HexahedronTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+            this->addPhysicalElement<HexahedronTrait<SimulationControl::kPolynomialOrder>>(mesh, statistics_physical,
+                                                                                            element_index, view_index);
+          }
+        }
+      }
+    }
+    this->data_set_information_.clear();
+    this->data_set_information_.emplace_back("TMSTEP", vtu11::DataSetType::FieldData, 1, 1);
+    this->data_set_information_.emplace_back("TimeValue", vtu11::DataSetType::FieldData, 1, 1);
+    this->data_set_information_.emplace_back("SampleNumber", vtu11::DataSetType::FieldData, 1, 1);
+    for (const std::string_view prefix : {"Mean", "RMS"}) {
+      for (Isize i = 0; i < kVariableNumber; i++) {
+        this->data_set_information_.emplace_back(std::format("{}{}", prefix, this->getVariableName(i)),
+                                                 vtu11::DataSetType::PointData, 1, 0);
+      }
+    }
+    for (const auto& [first_index, second_index] : this->correlation_index_) {
+      this->data_set_information_.emplace_back(
+          std::format("{}{}Covariance", this->getVariableName(first_index), this->getVariableName(second_index)),
+          vtu11::DataSetType::PointData, 1, 0);
+    }
+  }
+
+  inline void initializeStatistics(const Mesh<SimulationControl>& mesh, const std::filesystem::path& output_directory,
+                                   const std::string& output_file_name_prefix, const int iteration_start,
+                                   const bool is_append) {
+    this->correlation_index_.clear();
+    for (const auto& [first_variable, second_variable] : this->correlation_) {
+      this->correlation_index_.emplace_back(getStatisticsVariableIndex<SimulationControl>(first_variable),
+                                            getStatisticsVariableIndex<SimulationControl>(second_variable));
+    }
+    this->row_number_ = 2 * kVariableNumber + static_cast<Isize>(this->correlation_index_.size());
+    this->output_directory_ = output_directory;
+    this->output_file_name_prefix_ = output_file_name_prefix;
+    this->sample_number_ = 0;
+    this->last_step_ = -1;
+    this->write_step_ = -1;
+    this->accumulator_ = Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic>::Zero(this->row_number_,
+                                                                                    getColumnNumber(mesh));
+    std::filesystem::create_directories(output_directory);
+    if (is_append) {
+      this->readAccumulator(iteration_start);
+    }
+    this->initializePhysical(mesh);
+    this->is_open_ = true;
+  }
+
+  template <typename ElementTrait>
+  inline void accumulateElement(const Mesh<SimulationControl>& mesh,
+                                const PhysicalModel<SimulationControl>& physical_model,
+                                const Solver<SimulationControl>& solver) {
+    const ElementMesh<ElementTrait>& element_mesh =
+        mesh.*(Mesh<SimulationControl>::template getElement<ElementTrait>());
+    const ElementSolver<ElementTrait, SimulationControl>& element_solver =
+        solver.*(Solver<SimulationControl>::template getElement<ElementTrait>());
+    const Isize column_offset = getElementColumnOffset<ElementTrait>(mesh);
+    const Real weight = 1.0_r / static_cast<Real>(this->sample_number_);
+    parallelFor(0, element_mesh.number_, [&](const tbb::blocked_range<Isize>& range) {
+      ElementVariable<ElementTrait, SimulationControl> variable;
+      Eigen::Matrix<Real, Eigen::Dynamic, ElementTrait::kQuadratureNumber> sample(this->row_number_,
+                                                                                  ElementTrait::kQuadratureNumber);
+      for (Isize i = range.begin(); i != range.end(); i++) {
+        variable.get(element_mesh, element_solver, i);
+        variable.calculateComputationalFromConserved(physical_model);
+        variable.calculatePrimitiveFromConserved(physical_model);
+        sample.topRows(SimulationControl::kPrimitiveVariableNumber) = variable.primitive_;
+        sample.row(SimulationControl::kPrimitiveVariableNumber) =
+            variable.template getRow<ComputationalVariableEnum::Pressure>().matrix();
+        sample.middleRows(kVariableNumber, kVariableNumber) =
+            sample.topRows(kVariableNumber).array().square().matrix();
+        for (Isize j = 0; const auto& [first_index, second_index] : this->correlation_index_) {
+          sample.row(2 * kVariableNumber + j) = sample.row(first_index).cwiseProduct(sample.row(second_index));
+          j++;
+        }
+        auto accumulator = this->accumulator_.middleCols(
+            column_offset + i * ElementTrait::kBasisFunctionNumber, ElementTrait::kBasisFunctionNumber);
+        accumulator += weight * (sample * element_mesh.basis_function_.modal_value_ *
+                                     element_mesh.basis_function_.modal_least_squares_inverse_ -
+                                 accumulator);
+      }
+    });
+  }
+
+  inline void accumulateStatistics(const int step, const Mesh<SimulationControl>& mesh,
+                                   const PhysicalModel<SimulationControl>& physical_model,
+                                   const Solver<SimulationControl>& solver) {
+    if (step < this->start_step_ || (step - this->start_step_) % this->interval_ != 0 || step <= this->last_step_) {
+      return;
+    }
+    this->sample_number_++;
+    if constexpr (SimulationControl::kDimension == 1) {
+      this->accumulateElement<LineTrait<SimulationControl::kPolynomialOrder>>(mesh, physical_model, solver);
+    } else if constexpr (SimulationControl::kDimension == 2) {
+      if constexpr (HasTriangle<SimulationControl::kMeshModel>) {
+        this->accumulateElement<TriangleTrait<SimulationControl::kPolynomialOrder>>(mesh, physical_model, solver);
+      }
+      if constexpr (HasQuadrangle<SimulationControl::kMeshModel>) {
+        this->accumulateElement<QuadrangleTrait<SimulationControl::kPolynomialOrder>>(mesh, physical_model, solver);
+      }
+    } else if constexpr (SimulationControl::kDimension == 3) {
+      if constexpr (HasTetrahedron<SimulationControl::kMeshModel>) {
+        this->accumulateElement<TetrahedronTrait<SimulationControl::kPolynomialOrder>>(mesh, physical_model, solver);
+      }
+      if constexpr (HasPyramid<SimulationControl::kMeshModel>) {
+        this->accumulateElement<PyramidTrait<SimulationControl::kPolynomialOrder>>(mesh, physical_model, solver);
+      }
+      if constexpr (HasHexahedron<SimulationControl::kMeshModel>) {
+        this->accumulateElement<HexahedronTrait<SimulationControl::kPolynomialOrder>>(mesh, physical_model, solver);
+      }
+    }
+    this->last_step_ = step;
+  }
+
+  // NOTE: The accumulator is written under a temporary name and renamed into place, so an interrupted write keeps the
+  // accumulator of the previous checkpoint for the restart.
+  inline void writeAccumulator() {
+    const std::vector<std::uint32_t> header = this->getHeader();
+    const std::array<std::int32_t, 2> step{this->last_step_, this->sample_number_};
+    const auto column_number = static_cast<std::uint64_t>(this->accumulator_.cols());
+    const std::filesystem::path accumulator_file_path = this->getAccumulatorFilePath();
+    std::filesystem::path partial_accumulator_file_path = accumulator_file_path;
+    partial_accumulator_file_path += ".part";
+    std::ofstream fout(partial_accumulator_file_path, std::ios::out | std::ios::binary | std::ios::trunc);
+    fout.write(kStatisticsMagic.data(), static_cast<std::streamsize>(kStatisticsMagic.size()));
+    fout.write(reinterpret_cast<const char*>(header.data()),
+               static_cast<std::streamsize>(header.size() * sizeof(std::uint32_t)));
+    fout.write(reinterpret_cast<const char*>(step.data()),
+               static_cast<std::streamsize>(step.size() * sizeof(std::int32_t)));
+    fout.write(reinterpret_cast<const char*>(&column_number), sizeof(std::uint64_t));
+    fout.write(reinterpret_cast<const char*>(this->accumulator_.data()),
+               static_cast<std::streamsize>(this->accumulator_.size()) * kRealSize);
+    fout.close();
+    if (!fout) [[unlikely]] {
+      std::filesystem::remove(partial_accumulator_file_path);
+      throw std::runtime_error(
+          std::format("Statistics accumulator {} can not be written.", accumulator_file_path.string()));
+    }
+    std::filesystem::rename(partial_accumulator_file_path, accumulator_file_path);
+  }
+
+  template <typename ElementTrait>
+  inline void writeElementNodeValue(const Mesh<SimulationControl>& mesh,
+                                    const ViewSolver<SimulationControl>& view_solver, const Isize element_index,
+                                    const ViewIndex<SimulationControl>& view_index,
+                                    std::vector<vtu11::DataSetData>& data_set_data) const {
+    const ElementViewSolver<ElementTrait, SimulationControl>& element_view_solver =
+        view_solver.*(ViewSolver<SimulationControl>::template getElement<ElementTrait>());
+    const Eigen::Matrix<Real, Eigen::Dynamic, ElementTrait::kAllNodeNumber> node_value =
+        this->accumulator_.middleCols(getElementColumnOffset<ElementTrait>(mesh) +
+                                          element_index * ElementTrait::kBasisFunctionNumber,
+                                      ElementTrait::kBasisFunctionNumber) *
+        element_view_solver.basis_function_.modal_value_;
+    for (Isize i = 0; i < ElementTrait::kAllNodeNumber; i++) {
+      const auto node_index = static_cast<Usize>(view_index.node_index_ + i);
+      for (Isize j = 0; j < kVariableNumber; j++) {
+        const Real mean = node_value(j, i);
+        data_set_data[3 + static_cast<Usize>(j)][node_index] = static_cast<double>(mean);
+        data_set_data[3 + static_cast<Usize>(kVariableNumber + j)][node_index] =
+            static_cast<double>(std::sqrt(std::ranges::max(node_value(kVariableNumber + j, i) - mean * mean, 0.0_r)));
+      }
+      for (Isize j = 0; const auto& [first_index, second_index] : this->correlation_index_) {
+        data_set_data[3 + static_cast<Usize>(2 * kVariableNumber + j)][node_index] = static_cast<double>(
+            node_value(2 * kVariableNumber + j, i) - node_value(first_index, i) * node_value(second_index, i));
+        j++;
+      }
+    }
+  }
+
+  inline void writePhysical(const int step, const Real time_value, const Mesh<SimulationControl>& mesh,
+                            const ViewSolver<SimulationControl>& view_solver,
+                            StatisticsPhysical<SimulationControl>& statistics_physical,
+                            const ViewWriteModeEnum write_mode, const int compression_level) {
+    const PhysicalInformation& physical =
+        mesh.information_.physical_[static_cast<Usize>(statistics_physical.physical_index_)];
+    ViewSupplemental<SimulationControl>& view_supplemental = statistics_physical.view_supplemental_;
+    view_supplemental.data_set_data_.resize(this->data_set_information_.size());
+    view_supplemental.data_set_data_[0].assign(1, static_cast<double>(step));
+    view_supplemental.data_set_data_[1].assign(1, static_cast<double>(time_value));
+    view_supplemental.data_set_data_[2].assign(1, static_cast<double>(this->sample_number_));
+    for (std::size_t i = 3; i < view_supplemental.data_set_data_.size(); i++) {
+      view_supplemental.data_set_data_[i].resize(static_cast<std::size_t>(physical.node_number_));
+    }
+    parallelFor(0, physical.element_number_, [&](const tbb::blocked_range<Isize>& range) {
+      for (Isize i = range.begin(); i != range.end(); i++) {
+        const int element_gmsh_type = statistics_physical.element_gmsh_type_[static_cast<Usize>(i)];
+        const Isize element_index = statistics_physical.element_index_[static_cast<Usize>(i)];
+        const ViewIndex<SimulationControl>& view_index = statistics_physical.view_index_[static_cast<Usize>(i)];
+        if constexpr (SimulationControl::kDimension == 1) {
+          this->writeElementNodeValue<LineTrait<SimulationControl::kPolynomialOrder>>(
+              mesh, view_solver, element_index, view_index, view_supplemental.data_set_data_);
+        } else if constexpr (SimulationControl::kDimension == 2) {
+          if (element_gmsh_type == TriangleTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+            this->writeElementNodeValue<TriangleTrait<SimulationControl::kPolynomialOrder>>(
+                mesh, view_solver, element_index, view_index, view_supplemental.data_set_data_);
+          } else if (element_gmsh_type == QuadrangleTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+            this->writeElementNodeValue<QuadrangleTrait<SimulationControl::kPolynomialOrder>>(
+                mesh, view_solver, element_index, view_index, view_supplemental.data_set_data_);
+          }
+        } else if constexpr (SimulationControl::kDimension == 3) {
+          if (element_gmsh_type == TetrahedronTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+            this->writeElementNodeValue<TetrahedronTrait<SimulationControl::kPolynomialOrder>>(
+                mesh, view_solver, element_index, view_index, view_supplemental.data_set_data_);
+          } else if (element_gmsh_type == PyramidTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+            this->writeElementNodeValue<PyramidTrait<SimulationControl::kPolynomialOrder>>(
+                mesh, view_solver, element_index, view_index, view_supplemental.data_set_data_);
+          } else if (element_gmsh_type == HexahedronTrait<SimulationControl::kPolynomialOrder>::kGmshTypeNumber) {
+            this->writeElementNodeValue<HexahedronTrait<SimulationControl::kPolynomialOrder>>(
+                mesh, view_solver, element_index, view_index, view_supplemental.data_set_data_);
+          }
+        }
+      }
+    });
+    vtu11::Vtu11UnstructuredMesh mesh_data{
+        {view_supplemental.node_coordinate_.data(),
+         view_supplemental.node_coordinate_.data() + view_supplemental.node_coordinate_.size()},
+        {view_supplemental.element_connectivity_.data(),
+         view_supplemental.element_connectivity_.data() + view_supplemental.element_connectivity_.size()},
+        {view_supplemental.element_offset_.data(),
+         view_supplemental.element_offset_.data() + view_supplemental.element_offset_.size()},
+        {view_supplemental.element_type_.data(),
+         view_supplemental.element_type_.data() + view_supplemental.element_type_.size()}};
+    writeVtuFile((this->output_directory_ /
+                  std::format("{}_statistics_{}.vtu", this->output_file_name_prefix_, statistics_physical.name_))
+                     .string(),
+                 mesh_data, this->data_set_information_, view_supplemental.data_set_data_, write_mode,
+                 compression_level);
+  }
+
+  // NOTE: One accumulator file and one view file per physical group are overwritten each time, so the statistics never
+  // take more space than a single snapshot.
+  inline void writeStatistics(const Real delta_time, const Mesh<SimulationControl>& mesh,
+                              const ViewSolver<SimulationControl>& view_solver, const ViewWriteModeEnum write_mode,
+                              const int compression_level) {
+    if (this->sample_number_ == 0 || this->write_step_ == this->last_step_) {
+      return;
+    }
+    this->writeAccumulator();
+    for (StatisticsPhysical<SimulationControl>& statistics_physical : this->physical_) {
+      this->writePhysical(this->last_step_, static_cast<Real>(this->last_step_) * delta_time, mesh, view_solver,
+                          statistics_physical, write_mode, compression_level);
+    }
+    this->write_step_ = this->last_step_;
+  }
+
+  inline void finalizeStatistics(const Real delta_time, const Mesh<SimulationControl>& mesh,
+                                 const ViewSolver<SimulationControl>& view_solver, const ViewWriteModeEnum write_mode,
+                                 const int compression_level) {
+    if (this->is_open_) {
+      this->writeStatistics(delta_time, mesh, view_solver, write_mode, compression_level);
+    }
+    this->is_open_ = false;
+  }
+};
+
+}  // namespace SubrosaDG
+
+#endif  // SUBROSA_DG_STATISTICS_CPP_
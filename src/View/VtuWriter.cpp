@@ -0,0 +1,121 @@
+/**
+ * @file VtuWriter.cpp
+ * @brief The header file of SubrosaDG vtu writer.
+ *
+ * @author Yufei.Liu, Calm.Liu@outlook.com | Chenyu.Bao, bcynuaa@163.com
+ * @date 2025-04-12
+ *
+ * @version 0.1.0
+ * @copyright Copyright (c) 2022 - 2025 by SubrosaDG developers. All rights reserved.
+ * SubrosaDG is free software and is distributed under the MIT license.
+ */
+
+#ifndef SUBROSA_DG_VTU_WRITER_CPP_
+#define SUBROSA_DG_VTU_WRITER_CPP_
+
+#include <oneapi/tbb.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <format>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <vtu11-cpp17.hpp>
+
+#include "Utils/Enum.cpp"
+
+namespace SubrosaDG {
+
+inline constexpr std::size_t kVtuBlockSize{static_cast<std::size_t>(1) << 15};
+inline constexpr int kVtuCompressionLevel{Z_DEFAULT_COMPRESSION};
+
+// NOTE: Same appended layout as vtkZLibDataCompressor, the header of each array holds the block number, the block size,
+// the size of the last block and the compressed size of every block. The blocks of one array are compressed in
+// parallel, so the offset of the next array is known as soon as writeData returns.
+struct VtuCompressedWriter {
+  int compression_level_{kVtuCompressionLevel};
+  std::size_t offset_{0};
+  std::vector<std::vector<vtu11::HeaderType>> header_;
+  std::vector<std::vector<std::vector<vtu11::Byte>>> appended_data_;
+
+  template <typename T>
+  inline void writeData(std::ostream& /*output*/, const std::vector<T>& data) {
+    std::vector<vtu11::HeaderType>& header = this->header_.emplace_back(3, 0);
+    std::vector<std::vector<vtu11::Byte>>& compressed_block = this->appended_data_.emplace_back();
+    const std::size_t byte_number = data.size() * sizeof(T);
+    if (byte_number != 0) {
+      const std::size_t block_number = (byte_number - 1) / kVtuBlockSize + 1;
+      const auto* byte = reinterpret_cast<const vtu11::Byte*>(data.data());
+      header.resize(3 + block_number);
+      compressed_block.resize(block_number);
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, block_number),
+                        [&](const tbb::blocked_range<std::size_t>& range) {
+                          for (std::size_t i = range.begin(); i != range.end(); i++) {
+                            const std::size_t block_size =
+                                std::ranges::min(kVtuBlockSize, byte_number - i * kVtuBlockSize);
+                            uLongf compressed_size = compressBound(static_cast<uLong>(block_size));
+                            compressed_block[i].resize(compressed_size);
+                            const int error_code =
+                                compress2(compressed_block[i].data(), &compressed_size, byte + i * kVtuBlockSize,
+                                          static_cast<uLong>(block_size), this->compression_level_);
+                            if (error_code != Z_OK) [[unlikely]] {
+                              throw std::runtime_error(std::format("Error in zlib compression (code {}).", error_code));
+                            }
+                            compressed_block[i].resize(compressed_size);
+                            header[3 + i] = compressed_size;
+                          }
+                        });
+      header[0] = block_number;
+      header[1] = kVtuBlockSize;
+      header[2] = byte_number - (block_number - 1) * kVtuBlockSize;
+    }
+    this->offset_ += header.size() * sizeof(vtu11::HeaderType);
+    for (const std::vector<vtu11::Byte>& block : compressed_block) {
+      this->offset_ += block.size();
+    }
+  }
+
+  inline void writeAppended(std::ostream& output) {
+    for (std::size_t i = 0; i < this->appended_data_.size(); i++) {
+      output.write(reinterpret_cast<const char*>(this->header_[i].data()),
+                   static_cast<std::streamsize>(this->header_[i].size() * sizeof(vtu11::HeaderType)));
+      for (const std::vector<vtu11::Byte>& block : this->appended_data_[i]) {
+        output.write(reinterpret_cast<const char*>(block.data()), static_cast<std::streamsize>(block.size()));
+      }
+    }
+    output << "\n";
+  }
+
+  inline void addHeaderAttributes(vtu11::StringStringMap& attributes) {
+    attributes["header_type"] = vtu11::dataTypeString<vtu11::HeaderType>();
+    attributes["compressor"] = "vtkZLibDataCompressor";
+  }
+
+  inline void addDataAttributes(vtu11::StringStringMap& attributes) {
+    attributes["format"] = "appended";
+    attributes["offset"] = std::to_string(this->offset_);
+  }
+
+  inline vtu11::StringStringMap appendedAttributes() { return {{"encoding", "raw"}}; }
+};
+
+// NOTE: The raw mode skips the compression and only copies the arrays behind the xml part.
+template <typename MeshGenerator>
+inline void writeVtuFile(const std::string& file_name, MeshGenerator& mesh,
+                         const std::vector<vtu11::DataSetInfo>& data_set_information,
+                         const std::vector<vtu11::DataSetData>& data_set_data, const ViewWriteModeEnum write_mode,
+                         const int compression_level) {
+  if (write_mode == ViewWriteModeEnum::RawBinary) {
+    vtu11::detail::writeVtu(file_name, mesh, data_set_information, data_set_data, vtu11::RawBinaryAppendedWriter{});
+  } else {
+    vtu11::detail::writeVtu(file_name, mesh, data_set_information, data_set_data,
+                            VtuCompressedWriter{.compression_level_ = compression_level});
+  }
+}
+
+}  // namespace SubrosaDG
+
+#endif  // SUBROSA_DG_VTU_WRITER_CPP_
@@ -0,0 +1,329 @@
+/**
+ * @file XdmfWriter.cpp
+ * @brief The header file of SubrosaDG xdmf writer.
+ *
+ * @author Yufei.Liu, Calm.Liu@outlook.com | Chenyu.Bao, bcynuaa@163.com
+ * @date 2025-04-13
+ *
+ * @version 0.1.0
+ * @copyright Copyright (c) 2022 - 2025 by SubrosaDG developers. All rights reserved.
+ * SubrosaDG is free software and is distributed under the MIT license.
+ */
+
+#ifndef SUBROSA_DG_XDMF_WRITER_CPP_
+#define SUBROSA_DG_XDMF_WRITER_CPP_
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <ios>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <vtu11-cpp17.hpp>
+
+#include "Mesh/BasisFunction.cpp"
+#include "Solver/SimulationControl.cpp"
+#include "Utils/BasicDataType.cpp"
+#include "Utils/Enum.cpp"
+
+namespace SubrosaDG {
+
+// NOTE: XDMF has no Lagrange cells of arbitrary order, so each VTK Lagrange cell is written as the linear cells of its
+// equispaced node lattice and every node of the element is a vertex of the XDMF mesh, a curve is one polyline.
+inline std::pair<int, int> getXdmfTopology(const vtu11::VtkCellType vtk_type) {
+  switch (vtk_type) {
+  case 68:
+    return {2, 2};
+  case 69:
+    return {4, 3};
+  case 70:
+    return {5, 4};
+  case 71:
+    return {6, 4};
+  case 72:
+    return {9, 8};
+  default:
+    throw std::runtime_error(std::format("Unsupported VTK cell type {} in XDMF output.", static_cast<int>(vtk_type)));
+  }
+}
+
+// NOTE: The lattice index of a node is its reference coordinate scaled to [0, P], the node of the VTK layout at each
+// lattice point is found from the gmsh node coordinates and the VTK connectivity of the element.
+template <ElementEnum ElementType, int PolynomialOrder>
+inline std::vector<std::vector<int>> getXdmfSubCell() {
+  constexpr int kDimension{getElementDimension<ElementType>()};
+  constexpr int kNodeNumber{getElementNodeNumber<ElementType, PolynomialOrder>()};
+  constexpr std::array<int, kNodeNumber> kVtkConnectivity{getElementVTKConnectivity<ElementType, PolynomialOrder>()};
+  const Eigen::Matrix<double, kDimension, kNodeNumber> node_coordinate{
+      getElementNodeCoordinate<ElementType, PolynomialOrder>().data()};
+  const Eigen::Vector<double, kDimension> minimum_coordinate = node_coordinate.rowwise().minCoeff();
+  const Eigen::Vector<double, kDimension> coordinate_range = node_coordinate.rowwise().maxCoeff() - minimum_coordinate;
+  std::map<std::array<int, 3>, int> lattice_node;
+  for (int i = 0; i < kNodeNumber; i++) {
+    std::array<int, 3> lattice{0, 0, 0};
+    for (int j = 0; j < kDimension; j++) {
+      const double coordinate = node_coordinate(j, kVtkConnectivity[static_cast<Usize>(i)]) - minimum_coordinate(j);
+      lattice[static_cast<Usize>(j)] =
+          static_cast<int>(std::lround(PolynomialOrder * coordinate / coordinate_range(j)));
+    }
+    lattice_node[lattice] = i;
+  }
+  const auto node = [&lattice_node](const int i, const int j, const int k) { return lattice_node.at({i, j, k}); };
+  std::vector<std::vector<int>> sub_cell;
+  if constexpr (ElementType == ElementEnum::Line) {
+    std::vector<int>& polyline = sub_cell.emplace_back();
+    for (int i = 0; i <= PolynomialOrder; i++) {
+      polyline.emplace_back(node(i, 0, 0));
+    }
+  }
+  if constexpr (ElementType == ElementEnum::Triangle) {
+    for (int j = 0; j < PolynomialOrder; j++) {
+      for (int i = 0; i + j < PolynomialOrder; i++) {
+        sub_cell.push_back({node(i, j, 0), node(i + 1, j, 0), node(i, j + 1, 0)});
+        if (i + j < PolynomialOrder - 1) {
+          sub_cell.push_back({node(i + 1, j, 0), node(i + 1, j + 1, 0), node(i, j + 1, 0)});
+        }
+      }
+    }
+  }
+  if constexpr (ElementType == ElementEnum::Quadrangle) {
+    for (int j = 0; j < PolynomialOrder; j++) {
+      for (int i = 0; i < PolynomialOrder; i++) {
+        sub_cell.push_back({node(i, j, 0), node(i + 1, j, 0), node(i + 1, j + 1, 0), node(i, j + 1, 0)});
+      }
+    }
+  }
+  if constexpr (ElementType == ElementEnum::Tetrahedron) {
+    // NOTE: The lattice of a tetrahedron is filled by the upward tetrahedra, the octahedra between them which are split
+    // along one diagonal into four tetrahedra and the downward tetrahedra, the vertices are swapped when needed so that
+    // every sub-cell keeps the orientation of the element.
+    const auto add_tetrahedron = [&sub_cell, &node](std::array<std::array<int, 3>, 4> vertex) {
+      Eigen::Matrix3i edge;
+      for (Isize i = 0; i < 3; i++) {
+        for (Isize j = 0; j < 3; j++) {
+          edge(j, i) = vertex[static_cast<Usize>(i + 1)][static_cast<Usize>(j)] - vertex[0][static_cast<Usize>(j)];
+        }
+      }
+      if (edge.determinant() < 0) {
+        std::swap(vertex[2], vertex[3]);
+      }
+      std::vector<int>& tetrahedron = sub_cell.emplace_back();
+      for (const auto& [i, j, k] : vertex) {
+        tetrahedron.emplace_back(node(i, j, k));
+      }
+    };
+    for (int k = 0; k < PolynomialOrder; k++) {
+      for (int j = 0; j + k < PolynomialOrder; j++) {
+        for (int i = 0; i + j + k < PolynomialOrder; i++) {
+          add_tetrahedron({{{i, j, k}, {i + 1, j, k}, {i, j + 1, k}, {i, j, k + 1}}});
+          if (i + j + k < PolynomialOrder - 1) {
+            const std::array<int, 3> a{i + 1, j, k};
+            const std::array<int, 3> b{i, j + 1, k};
+            const std::array<int, 3> c{i, j, k + 1};
+            const std::array<int, 3> d{i + 1, j + 1, k};
+            const std::array<int, 3> e{i + 1, j, k + 1};
+            const std::array<int, 3> f{i, j + 1, k + 1};
+            add_tetrahedron({a, f, b, d});
+            add_tetrahedron({a, f, d, e});
+            add_tetrahedron({a, f, e, c});
+            add_tetrahedron({a, f, c, b});
+          }
+          if (i + j + k < PolynomialOrder - 2) {
+            add_tetrahedron({{{i + 1, j + 1, k}, {i + 1, j, k + 1}, {i, j + 1, k + 1}, {i + 1, j + 1, k + 1}}});
+          }
+        }
+      }
+    }
+  }
+  if constexpr (ElementType == ElementEnum::Hexahedron) {
+    for (int k = 0; k < PolynomialOrder; k++) {
+      for (int j = 0; j < PolynomialOrder; j++) {
+        for (int i = 0; i < PolynomialOrder; i++) {
+          sub_cell.push_back({node(i, j, k), node(i + 1, j, k), node(i + 1, j + 1, k), node(i, j + 1, k),
+                              node(i, j, k + 1), node(i + 1, j, k + 1), node(i + 1, j + 1, k + 1),
+                              node(i, j + 1, k + 1)});
+        }
+      }
+    }
+  }
+  return sub_cell;
+}
+
+// NOTE: The sub-cells are indexed by the VTK cell type, a pyramid is already written as two VTK tetrahedra so it uses
+// the sub-cells of the tetrahedron.
+struct XdmfSubCell {
+  std::array<std::vector<std::vector<int>>, 5> node_index_;
+
+  template <int PolynomialOrder>
+  inline void initializeXdmfSubCell() {
+    this->node_index_ = {getXdmfSubCell<ElementEnum::Line, PolynomialOrder>(),
+                         getXdmfSubCell<ElementEnum::Triangle, PolynomialOrder>(),
+                         getXdmfSubCell<ElementEnum::Quadrangle, PolynomialOrder>(),
+                         getXdmfSubCell<ElementEnum::Tetrahedron, PolynomialOrder>(),
+                         getXdmfSubCell<ElementEnum::Hexahedron, PolynomialOrder>()};
+  }
+
+  inline const std::vector<std::vector<int>>& get(const vtu11::VtkCellType vtk_type) const {
+    return this->node_index_[static_cast<Usize>(vtk_type) - 68];
+  }
+};
+
+template <typename T>
+inline void writeXdmfBinary(std::ofstream& fout, const std::vector<T>& data) {
+  fout.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(T)));
+}
+
+struct XdmfTopologyNumber {
+  Isize topology_number_{0};
+  Isize element_number_{0};
+};
+
+// NOTE: The mesh file holds the node coordinates followed by the mixed topology, a polyline also stores its node
+// number after the cell type. The number of topology entries and of sub-cells is returned for the descriptor.
+inline XdmfTopologyNumber writeXdmfMeshFile(
+    const std::filesystem::path& file_path, const Eigen::Matrix<Real, 3, Eigen::Dynamic>& node_coordinate,
+    const Eigen::Vector<vtu11::VtkIndexType, Eigen::Dynamic>& element_connectivity,
+    const Eigen::Vector<vtu11::VtkIndexType, Eigen::Dynamic>& element_offset,
+    const Eigen::Vector<vtu11::VtkCellType, Eigen::Dynamic>& element_type, const XdmfSubCell& xdmf_sub_cell) {
+  std::vector<double> coordinate(node_coordinate.data(), node_coordinate.data() + node_coordinate.size());
+  std::vector<std::int64_t> topology;
+  Isize element_number = 0;
+  for (Isize i = 0; i < element_type.size(); i++) {
+    const int xdmf_type = getXdmfTopology(element_type(i)).first;
+    const vtu11::VtkIndexType begin = i == 0 ? 0 : element_offset(i - 1);
+    for (const std::vector<int>& sub_cell : xdmf_sub_cell.get(element_type(i))) {
+      topology.emplace_back(xdmf_type);
+      if (xdmf_type == 2) {
+        topology.emplace_back(static_cast<std::int64_t>(sub_cell.size()));
+      }
+      for (const int node_index : sub_cell) {
+        topology.emplace_back(element_connectivity(begin + node_index));
+      }
+      element_number++;
+    }
+  }
+  std::ofstream fout(file_path, std::ios::out | std::ios::binary | std::ios::trunc);
+  writeXdmfBinary(fout, coordinate);
+  writeXdmfBinary(fout, topology);
+  fout.close();
+  return {.topology_number_ = static_cast<Isize>(topology.size()), .element_number_ = element_number};
+}
+
+// NOTE: A mesh file written by an earlier view is read back to count its topology entries and sub-cells.
+inline XdmfTopologyNumber readXdmfMeshFile(const std::filesystem::path& file_path, const Isize node_number) {
+  const std::uintmax_t coordinate_size = static_cast<std::uintmax_t>(node_number) * 3 * sizeof(double);
+  std::vector<std::int64_t> topology((std::filesystem::file_size(file_path) - coordinate_size) / sizeof(std::int64_t));
+  std::ifstream fin(file_path, std::ios::in | std::ios::binary);
+  fin.seekg(static_cast<std::streamoff>(coordinate_size));
+  fin.read(reinterpret_cast<char*>(topology.data()),
+           static_cast<std::streamsize>(topology.size() * sizeof(std::int64_t)));
+  fin.close();
+  XdmfTopologyNumber topology_number{.topology_number_ = static_cast<Isize>(topology.size()), .element_number_ = 0};
+  Usize i = 0;
+  while (i < topology.size()) {
+    topology_number.element_number_++;
+    switch (topology[i]) {
+    case 2:
+      i += 2 + static_cast<Usize>(topology[i + 1]);
+      break;
+    case 4:
+      i += 4;
+      break;
+    case 5:
+    case 6:
+      i += 5;
+      break;
+    case 9:
+      i += 9;
+      break;
+    default:
+      throw std::runtime_error(std::format("XDMF mesh file {} has an unknown cell type {}.", file_path.string(),
+                                           topology[i]));
+    }
+  }
+  return topology_number;
+}
+
+// NOTE: The field file of one step starts with the field data (time step, time value and force) and then holds the
+// point data arrays in the order of the data set information.
+inline void writeXdmfFieldFile(const std::filesystem::path& file_path,
+                               const std::vector<vtu11::DataSetData>& data_set_data) {
+  std::ofstream fout(file_path, std::ios::out | std::ios::binary | std::ios::trunc);
+  for (const vtu11::DataSetData& data : data_set_data) {
+    writeXdmfBinary(fout, data);
+  }
+  fout.close();
+}
+
+struct XdmfMeshInformation {
+  std::string mesh_file_name_;
+  Isize node_number_;
+  Isize element_number_;
+  Isize topology_number_;
+};
+
+inline std::string getXdmfDataItem(const std::string_view dimension, const std::string_view number_type,
+                                   const std::size_t seek, const std::string_view file_name) {
+  return std::format(
+      "<DataItem Dimensions=\"{}\" NumberType=\"{}\" Precision=\"8\" Format=\"Binary\" Endian=\"Little\" "
+      "Seek=\"{}\">{}</DataItem>",
+      dimension, number_type, seek, file_name);
+}
+
+// NOTE: One temporal collection per physical group, every step points at the same mesh file and at its own field file,
+// so the mesh is stored only once for the whole series.
+inline void writeXdmfCollection(const std::filesystem::path& file_path, const XdmfMeshInformation& mesh_information,
+                                const std::vector<vtu11::DataSetInfo>& data_set_information,
+                                const std::vector<std::pair<Real, std::string>>& step_information) {
+  const std::size_t coordinate_size = static_cast<std::size_t>(mesh_information.node_number_) * 3 * sizeof(double);
+  std::ofstream fout(file_path, std::ios::out | std::ios::trunc);
+  fout << "<?xml version=\"1.0\"?>\n";
+  fout << "<Xdmf Version=\"3.0\">\n";
+  fout << "  <Domain>\n";
+  fout << "    <Grid Name=\"TimeSeries\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+  for (const auto& [time_value, field_file_name] : step_information) {
+    fout << "      <Grid GridType=\"Uniform\">\n";
+    fout << std::format("        <Time Value=\"{}\"/>\n", time_value);
+    fout << std::format("        <Topology TopologyType=\"Mixed\" NumberOfElements=\"{}\">\n",
+                        mesh_information.element_number_);
+    fout << std::format("          {}\n", getXdmfDataItem(std::to_string(mesh_information.topology_number_), "Int",
+                                                         coordinate_size, mesh_information.mesh_file_name_));
+    fout << "        </Topology>\n";
+    fout << "        <Geometry GeometryType=\"XYZ\">\n";
+    fout << std::format("          {}\n",
+                        getXdmfDataItem(std::format("{} 3", mesh_information.node_number_), "Float", 0,
+                                        mesh_information.mesh_file_name_));
+    fout << "        </Geometry>\n";
+    std::size_t seek = 0;
+    for (const auto& [name, type, component_number, tuple_number] : data_set_information) {
+      const bool is_point_data = type == vtu11::DataSetType::PointData;
+      const Isize value_number = is_point_data ? mesh_information.node_number_ : static_cast<Isize>(tuple_number);
+      const std::string dimension = component_number == 1 ? std::to_string(value_number)
+                                                          : std::format("{} {}", value_number, component_number);
+      fout << std::format("        <Attribute Name=\"{}\" AttributeType=\"{}\" Center=\"{}\">\n", name,
+                          component_number == 1 ? "Scalar" : "Vector", is_point_data ? "Node" : "Grid");
+      fout << std::format("          {}\n", getXdmfDataItem(dimension, "Float", seek, field_file_name));
+      fout << "        </Attribute>\n";
+      seek += static_cast<std::size_t>(value_number) * component_number * sizeof(double);
+    }
+    fout << "      </Grid>\n";
+  }
+  fout << "    </Grid>\n";
+  fout << "  </Domain>\n";
+  fout << "</Xdmf>\n";
+  fout.close();
+}
+
+}  // namespace SubrosaDG
+
+#endif  // SUBROSA_DG_XDMF_WRITER_CPP_